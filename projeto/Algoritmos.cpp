@@ -1,9 +1,9 @@
 #include "Algoritmos.hpp"
 #include "Grafo.hpp"
 
-int Algoritmos::gapAresta(Aresta *aresta)
+int Algoritmos::gapAresta(const GrafoCSR &grafo, int aresta)
 {
-    return abs(aresta->origem->peso - aresta->destino->peso);
+    return abs(grafo.pesosVertices[grafo.origens[aresta]] - grafo.pesosVertices[grafo.destinos[aresta]]);
 }
 
 /**
@@ -15,26 +15,21 @@ int Algoritmos::gapAresta(Aresta *aresta)
  *
  * A função mantém a posição de um elemento caso haja empate na diferença de pesos dos vértices.
  *
- * @return std::list<Aresta*> Lista com as arestas ordenadas
+ * @return std::list<int> Lista com os índices (no CSR) das arestas ordenadas
  */
-std::list<Aresta *> Algoritmos::coletaArestasOrdenadas(Grafo *grafo)
+std::list<int> Algoritmos::coletaArestasOrdenadas(const GrafoCSR &grafo)
 {
-    std::list<Aresta *> arestas;
-    for (Vertice *vertice : grafo->vertices)
+    std::list<int> arestas;
+    for (int aresta = 0; aresta < grafo.numeroArcos(); aresta++)
     {
-        Aresta *aresta = vertice->arestas;
-        while (aresta != nullptr)
+        if (grafo.ids[grafo.origens[aresta]] < grafo.ids[grafo.destinos[aresta]]) // evita repetir arco de ida e volta
         {
-            if (aresta->origem->id < aresta->destino->id) // evita repetir arco de ida e volta
+            std::list<int>::iterator it = arestas.begin();
+            while (it != arestas.end() && gapAresta(grafo, aresta) >= gapAresta(grafo, *it))
             {
-                std::list<Aresta *>::iterator it = arestas.begin();
-                while (it != arestas.end() && gapAresta(aresta) >= gapAresta(*it))
-                {
-                    it++;
-                }
-                arestas.insert(it, aresta);
+                it++;
             }
-            aresta = aresta->prox;
+            arestas.insert(it, aresta);
         }
     }
     return arestas;
@@ -44,38 +39,40 @@ std::list<Aresta *> Algoritmos::coletaArestasOrdenadas(Grafo *grafo)
  * @brief Preenche a floresta com arestas não adjacentes.
  *
  * Esta função itera sobre as arestas fornecidas e adiciona aquelas que não são adjacentes
- * à floresta. A floresta é representada por um vetor de vetores de ponteiros para Aresta.
+ * à floresta. A floresta é representada por um vetor de vetores de índices de arestas no CSR.
  * A função também mantém um conjunto de vértices visitados.
  *
- * @param floresta Referência para uma matriz ponteiros para Aresta, representando a floresta.
- * @param arestas Referência para um vetor de ponteiros para Aresta, representando as arestas disponíveis.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param floresta Referência para uma matriz de índices de arestas, representando a floresta.
+ * @param arestas Referência para uma lista de índices de arestas, representando as arestas disponíveis.
  * @param visitados Referência para um conjunto de inteiros, representando os vértices visitados.
  * @param minimos Referência para um vetor de inteiros, representando os pesos mínimos de cada componente da floresta.
  * @param maximos Referência para um vetor de inteiros, representando os pesos máximos de cada componente da floresta.
  */
-void Algoritmos::preencheFloresta(std::vector<std::vector<Aresta *>> &floresta,
-        std::list<Aresta *> &arestas,
+void Algoritmos::preencheFloresta(const GrafoCSR &grafo,
+        std::vector<std::vector<int>> &floresta,
+        std::list<int> &arestas,
         std::set<int> &visitados,
         std::vector<int> &minimos,
         std::vector<int> &maximos)
 {
     for (int componente = 0; componente < floresta.size(); componente++)
     {
-        std::list<Aresta *>::iterator iter = arestas.begin();
+        std::list<int>::iterator iter = arestas.begin();
         while (iter != arestas.end())
         {
-            Aresta *aresta = *iter;
-            if (numeroDeVerticesAdjacentes(aresta, visitados) == 0)
+            int aresta = *iter;
+            if (numeroDeVerticesAdjacentes(grafo, aresta, visitados) == 0)
             {
-                Vertice *u = aresta->origem;
-                Vertice *v = aresta->destino;
-                int minAresta = std::min(u->peso, v->peso);
-                int maxAresta = std::max(u->peso, v->peso);
+                int u = grafo.origens[aresta];
+                int v = grafo.destinos[aresta];
+                int minAresta = std::min(grafo.pesosVertices[u], grafo.pesosVertices[v]);
+                int maxAresta = std::max(grafo.pesosVertices[u], grafo.pesosVertices[v]);
                 minimos[componente] = minAresta;
                 maximos[componente] = maxAresta;
                 floresta[componente].push_back(aresta);
-                visitados.insert(u->id);
-                visitados.insert(v->id);
+                visitados.insert(u);
+                visitados.insert(v);
                 iter = arestas.erase(iter);
                 break;
             }
@@ -88,16 +85,18 @@ void Algoritmos::preencheFloresta(std::vector<std::vector<Aresta *>> &floresta,
  * @brief Preenche a floresta com arestas não adjacentes, escolhendo aleatoriamente entre as alfa % melhores arestas.
  *
  * Esta função itera sobre as arestas fornecidas e adiciona aquelas que não são adjacentes
- * à floresta. A floresta é representada por um vetor de vetores de ponteiros para Aresta.
+ * à floresta. A floresta é representada por um vetor de vetores de índices de arestas no CSR.
  * A função também mantém um conjunto de vértices visitados.
  *
- * @param floresta Referência para uma matriz ponteiros para Aresta, representando a floresta.
- * @param arestas Referência para um vetor de ponteiros para Aresta, representando as arestas disponíveis.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param floresta Referência para uma matriz de índices de arestas, representando a floresta.
+ * @param arestas Referência para uma lista de índices de arestas, representando as arestas disponíveis.
  * @param visitados Referência para um conjunto de inteiros, representando os vértices visitados.
  * @param alfa Porcentagem que torna o algoritmo gulosoRandomizado. 0 < alfa <= 1.
  */
-void Algoritmos::preencheFlorestaRandomizado(std::vector<std::vector<Aresta *>> &floresta,
-                std::list<Aresta *> &arestas,
+void Algoritmos::preencheFlorestaRandomizado(const GrafoCSR &grafo,
+                std::vector<std::vector<int>> &floresta,
+                std::list<int> &arestas,
                 std::set<int> &visitados,
                 float alfa,
                 std::vector<int> &minimos,
@@ -107,14 +106,14 @@ void Algoritmos::preencheFlorestaRandomizado(std::vector<std::vector<Aresta *>>
     {
         int maxIndex = (int)((arestas.size() - 1) * alfa);
         int indexSelecionado = geraIndiceAleatorioEntreZeroE(maxIndex);
-        std::list<Aresta *>::iterator iter = arestas.begin();
+        std::list<int>::iterator iter = arestas.begin();
         for (int i = 0; i <= indexSelecionado; i++, ++iter);
-        Aresta *selecionada = *iter;
-        if (numeroDeVerticesAdjacentes(selecionada, visitados) == 0)
+        int selecionada = *iter;
+        if (numeroDeVerticesAdjacentes(grafo, selecionada, visitados) == 0)
         {
             floresta[componente].push_back(selecionada);
-            visitados.insert(selecionada->origem->id);
-            visitados.insert(selecionada->destino->id);
+            visitados.insert(grafo.origens[selecionada]);
+            visitados.insert(grafo.destinos[selecionada]);
             arestas.erase(iter);
         }
     }
@@ -123,27 +122,32 @@ void Algoritmos::preencheFlorestaRandomizado(std::vector<std::vector<Aresta *>>
 /**
  * @brief Calcula a quantos vértices já visitados uma aresta é adjacente (0, 1 ou 2).
  *
- * @param aresta Ponteiro para a aresta cujos vértices serão verificados.
- * @param visitados Conjunto de IDs de vértices que já foram visitados.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param aresta Índice da aresta cujos vértices serão verificados.
+ * @param visitados Conjunto de índices de vértices que já foram visitados.
  * @return int Número de vértices adjacentes à aresta que já foram visitados.
  */
-int Algoritmos::numeroDeVerticesAdjacentes(Aresta *aresta, std::set<int> &visitados)
+int Algoritmos::numeroDeVerticesAdjacentes(const GrafoCSR &grafo, int aresta, std::set<int> &visitados)
 {
     int adjacencias = 0;
-    if (visitados.find(aresta->origem->id) != visitados.end())
+    if (visitados.find(grafo.origens[aresta]) != visitados.end())
     {
         adjacencias++;
     }
-    if (visitados.find(aresta->destino->id) != visitados.end())
+    if (visitados.find(grafo.destinos[aresta]) != visitados.end())
     {
         adjacencias++;
     }
     return adjacencias;
 }
 
-bool Algoritmos::saoAdjacentes(Aresta *e, Aresta *aresta)
+bool Algoritmos::saoAdjacentes(const GrafoCSR &grafo, int e, int aresta)
 {
-    return e->origem == aresta->origem || e->origem == aresta->destino || e->destino == aresta->origem || e->destino == aresta->destino;
+    int origemE = grafo.origens[e];
+    int destinoE = grafo.destinos[e];
+    int origemAresta = grafo.origens[aresta];
+    int destinoAresta = grafo.destinos[aresta];
+    return origemE == origemAresta || origemE == destinoAresta || destinoE == origemAresta || destinoE == destinoAresta;
 }
 
 /**
@@ -152,31 +156,33 @@ bool Algoritmos::saoAdjacentes(Aresta *e, Aresta *aresta)
  * Esta função determina o impacto de adicionar uma aresta candidata em uma floresta de arestas,
  * atualizando os valores mínimos e máximos dos pesos das arestas na componente conectada.
  *
- * @param candidata Ponteiro para a aresta candidata a ser adicionada.
- * @param floresta Referência para um vetor de vetores de ponteiros de arestas, representando a floresta.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param candidata Índice da aresta candidata a ser adicionada.
+ * @param floresta Referência para um vetor de vetores de índices de arestas, representando a floresta.
  * @param minimos Referência para um vetor de inteiros contendo os valores mínimos dos pesos das arestas em cada componente.
  * @param maximos Referência para um vetor de inteiros contendo os valores máximos dos pesos das arestas em cada componente.
  * @return O impacto de adicionar a aresta candidata, calculado como a diferença entre o novo gap (diferença entre o peso máximo e mínimo) e o gap atual.
  */
-int Algoritmos::calculaImpacto(Aresta *candidata,
-        std::vector<std::vector<Aresta *>> &floresta,
+int Algoritmos::calculaImpacto(const GrafoCSR &grafo,
+        int candidata,
+        std::vector<std::vector<int>> &floresta,
         std::vector<int> &minimos,
         std::vector<int> &maximos)
 {
     int componente = -1;
     for (int i = 0; i < floresta.size(); i++)
     {
-        for (Aresta *aresta : floresta[i])
+        for (int aresta : floresta[i])
         {
-            if (saoAdjacentes(aresta, candidata))
+            if (saoAdjacentes(grafo, aresta, candidata))
             {
                 componente = i;
                 break;
             }
         }
     }
-    int pesoU = candidata->origem->peso;
-    int pesoV = candidata->destino->peso;
+    int pesoU = grafo.pesosVertices[grafo.origens[candidata]];
+    int pesoV = grafo.pesosVertices[grafo.destinos[candidata]];
     int minAresta = std::min(pesoU, pesoV);
     int maxAresta = std::max(pesoU, pesoV);
     int gapAtual = maximos[componente] - minimos[componente];
@@ -219,30 +225,32 @@ int Algoritmos::calculaGap(std::vector<int> &minimos, std::vector<int> &maximos)
  *
  * Ao longo da iteração, a lista de arestas candidatas é filtrada para remover aquelas que não podem ser adicionadas.
  *
- * @param floresta Referência para o vetor de componentes da floresta, onde cada componente é um vetor de ponteiros para arestas.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param floresta Referência para o vetor de componentes da floresta, onde cada componente é um vetor de índices de arestas.
  * @param arestas Referência para a lista de arestas candidatas existentes no grafo original que ainda não foram utilizadas.
  * @param visitados Referência para o conjunto de vértices já visitados.
  */
-void Algoritmos::adicionaNovaAresta(std::vector<std::vector<Aresta *>> &floresta,
-        std::list<Aresta *> &arestas,
+void Algoritmos::adicionaNovaAresta(const GrafoCSR &grafo,
+        std::vector<std::vector<int>> &floresta,
+        std::list<int> &arestas,
         std::set<int> &visitados,
         std::vector<int> &minimos,
         std::vector<int> &maximos)
 {
     int impactoMinimo = std::numeric_limits<int>::max();
-    std::list<Aresta*>::iterator melhor = arestas.end();
-    std::list<Aresta*>::iterator iter = arestas.begin();
+    std::list<int>::iterator melhor = arestas.end();
+    std::list<int>::iterator iter = arestas.begin();
     while (iter != arestas.end())
     {
-        Aresta *aresta = *iter;
-        if (numeroDeVerticesAdjacentes(aresta, visitados) == 2)
+        int aresta = *iter;
+        if (numeroDeVerticesAdjacentes(grafo, aresta, visitados) == 2)
         {
             iter = arestas.erase(iter);
             continue;
         }
-        if (numeroDeVerticesAdjacentes(aresta, visitados) == 1)
+        if (numeroDeVerticesAdjacentes(grafo, aresta, visitados) == 1)
         {
-            int impacto = calculaImpacto(aresta, floresta, minimos, maximos);
+            int impacto = calculaImpacto(grafo, aresta, floresta, minimos, maximos);
             if (impacto < impactoMinimo)
             {
                 melhor = iter;
@@ -251,28 +259,28 @@ void Algoritmos::adicionaNovaAresta(std::vector<std::vector<Aresta *>> &floresta
         }
         iter++;
     }
-    Aresta *adicionada = *melhor;
+    int adicionada = *melhor;
     int componente = -1;
     for (int i = 0; i < floresta.size(); i++)
     {
-        for (Aresta *aresta : floresta[i])
+        for (int aresta : floresta[i])
         {
-            if (saoAdjacentes(aresta, adicionada))
+            if (saoAdjacentes(grafo, aresta, adicionada))
             {
                 componente = i;
                 break;
             }
         }
     }
-    int pesoU = adicionada->origem->peso;
-    int pesoV = adicionada->destino->peso;
+    int pesoU = grafo.pesosVertices[grafo.origens[adicionada]];
+    int pesoV = grafo.pesosVertices[grafo.destinos[adicionada]];
     int minAresta = std::min(pesoU, pesoV);
     int maxAresta = std::max(pesoU, pesoV);
     minimos[componente] = std::min(minimos[componente], minAresta);
     maximos[componente] = std::max(maximos[componente], maxAresta);
     floresta[componente].push_back(adicionada);
-    visitados.insert(adicionada->origem->id);
-    visitados.insert(adicionada->destino->id);
+    visitados.insert(grafo.origens[adicionada]);
+    visitados.insert(grafo.destinos[adicionada]);
     arestas.erase(melhor); // remove aresta utilizada da lista de candidatas
     return;
 }
@@ -307,25 +315,27 @@ int Algoritmos::geraIndiceAleatorioEntreZeroE(int max)
  *
  * Ao longo da iteração, a lista de arestas candidatas é filtrada para remover aquelas que não podem ser adicionadas.
  *
- * @param floresta Referência para a floresta representada como um vetor de vetores de ponteiros para Aresta.
+ * @param grafo Fotografia CSR do grafo original.
+ * @param floresta Referência para a floresta representada como um vetor de vetores de índices de arestas.
  * @param arestas Referência para a lista de arestas disponíveis para seleção.
- * @param visitados Referência para o conjunto de IDs de vértices já visitados.
+ * @param visitados Referência para o conjunto de índices de vértices já visitados.
  * @param alfa Parâmetro de controle da aleatoriedade na seleção da aresta (0 <= alfa <= 1).
  */
-void Algoritmos::adicionaNovaArestaRandomizado(std::vector<std::vector<Aresta *>> &floresta,
-                                               std::list<Aresta *> &arestas,
+void Algoritmos::adicionaNovaArestaRandomizado(const GrafoCSR &grafo,
+                                               std::vector<std::vector<int>> &floresta,
+                                               std::list<int> &arestas,
                                                std::set<int> &visitados,
                                                float alfa,
                                                std::vector<int> &minimos,
                                                std::vector<int> &maximos)
 {
-    std::list<Aresta *> candidatas;
-    std::list<Aresta *>::iterator iter = arestas.begin();
-    std::map<Aresta *, int> impactos;
+    std::list<int> candidatas;
+    std::list<int>::iterator iter = arestas.begin();
+    std::map<int, int> impactos;
     while (iter != arestas.end())
     {
-        Aresta *aresta = *iter;
-        int adjacencias = numeroDeVerticesAdjacentes(aresta, visitados);
+        int aresta = *iter;
+        int adjacencias = numeroDeVerticesAdjacentes(grafo, aresta, visitados);
         if (adjacencias == 2)
         {
             iter = arestas.erase(iter);
@@ -333,12 +343,12 @@ void Algoritmos::adicionaNovaArestaRandomizado(std::vector<std::vector<Aresta *>
         }
         if (adjacencias == 1)
         {
-            int impacto = calculaImpacto(aresta, floresta, minimos, maximos);
+            int impacto = calculaImpacto(grafo, aresta, floresta, minimos, maximos);
             impactos[aresta] = impacto;
-            std::list<Aresta *>::iterator iterCandidatas = candidatas.begin();
+            std::list<int>::iterator iterCandidatas = candidatas.begin();
             while (iterCandidatas != candidatas.end())
             {
-                Aresta *candidata = *iterCandidatas;
+                int candidata = *iterCandidatas;
                 if (impacto < impactos[candidata])
                 {
                     break;
@@ -351,35 +361,35 @@ void Algoritmos::adicionaNovaArestaRandomizado(std::vector<std::vector<Aresta *>
     }
     int maxIndex = (int)((candidatas.size() - 1) * alfa);
     int indexSelecionado = geraIndiceAleatorioEntreZeroE(maxIndex);
-    std::list<Aresta *>::iterator iterSelecionada = candidatas.begin();
+    std::list<int>::iterator iterSelecionada = candidatas.begin();
     for (int i = 0; i < indexSelecionado; i++)
     {
         ++iterSelecionada;
     }
-    Aresta *selecionada = *iterSelecionada;
+    int selecionada = *iterSelecionada;
     int componente = -1;
     for (int i = 0; i < floresta.size(); i++)
     {
-        for (Aresta *aresta : floresta[i])
+        for (int aresta : floresta[i])
         {
-            if (saoAdjacentes(aresta, selecionada))
+            if (saoAdjacentes(grafo, aresta, selecionada))
             {
                 componente = i;
                 break;
             }
         }
     }
-    Vertice *u = selecionada->origem;
-    Vertice *v = selecionada->destino;
-    int pesoU = u->peso;
-    int pesoV = v->peso;
-    int minAresta = std::min(u->peso, v->peso);
-    int maxAresta = std::max(u->peso, v->peso);
+    int u = grafo.origens[selecionada];
+    int v = grafo.destinos[selecionada];
+    int pesoU = grafo.pesosVertices[u];
+    int pesoV = grafo.pesosVertices[v];
+    int minAresta = std::min(pesoU, pesoV);
+    int maxAresta = std::max(pesoU, pesoV);
     minimos[componente] = std::min(minimos[componente], minAresta);
     maximos[componente] = std::max(maximos[componente], maxAresta);
     floresta[componente].push_back(selecionada);
-    visitados.insert(u->id);
-    visitados.insert(v->id);
+    visitados.insert(u);
+    visitados.insert(v);
     arestas.erase(std::find(arestas.begin(), arestas.end(), selecionada));
 }
 
@@ -400,30 +410,33 @@ void Algoritmos::adicionaNovaArestaRandomizado(std::vector<std::vector<Aresta *>
  */
 Grafo* Algoritmos::gulosoComum(Grafo *grafo, int numeroParticoes)
 {
-    std::list<Aresta *> arestas = coletaArestasOrdenadas(grafo);
-    std::vector<std::vector<Aresta *>> floresta(numeroParticoes);
+    GrafoCSR csr = grafo->congelar();
+    std::list<int> arestas = coletaArestasOrdenadas(csr);
+    std::vector<std::vector<int>> floresta(numeroParticoes);
     std::vector<int> minimos(numeroParticoes);
     std::vector<int> maximos(numeroParticoes);
     for (int i = 0; i < numeroParticoes; i++)
     {
-        floresta[i] = std::vector<Aresta *>();
+        floresta[i] = std::vector<int>();
     }
     std::set<int> visitados = std::set<int>();
-    preencheFloresta(floresta, arestas, visitados, minimos, maximos);
-    while (visitados.size() != grafo->vertices.size())
+    preencheFloresta(csr, floresta, arestas, visitados, minimos, maximos);
+    while (visitados.size() != csr.ordem())
     {
-        adicionaNovaAresta(floresta, arestas, visitados, minimos, maximos);
+        adicionaNovaAresta(csr, floresta, arestas, visitados, minimos, maximos);
     }
     int gap = calculaGap(minimos, maximos);
     std::cout << "Somatório dos gaps da solução encontrada = " << gap << '\n';
     Grafo *solucao = new Grafo(0, 0, 1);
     for (int i = 0; i < floresta.size(); i++)
     {
-        for (Aresta *aresta : floresta[i])
+        for (int aresta : floresta[i])
         {
-            solucao->adicionaVertice(aresta->origem->id, aresta->origem->peso);
-            solucao->adicionaVertice(aresta->destino->id, aresta->destino->peso);
-            solucao->adicionaAresta(aresta->origem->id, aresta->destino->id);
+            int u = csr.origens[aresta];
+            int v = csr.destinos[aresta];
+            solucao->adicionaVertice(csr.ids[u], csr.pesosVertices[u]);
+            solucao->adicionaVertice(csr.ids[v], csr.pesosVertices[v]);
+            solucao->adicionaAresta(csr.ids[u], csr.ids[v]);
         }
     }
     return solucao;
@@ -448,23 +461,24 @@ Grafo* Algoritmos::gulosoComum(Grafo *grafo, int numeroParticoes)
  */
 Grafo *Algoritmos::gulosoRandomizado(Grafo *grafo, int numeroParticoes, float alfa)
 {
+    GrafoCSR csr = grafo->congelar();
     int melhorGap = std::numeric_limits<int>::max();
-    std::vector<std::vector<Aresta *>> solucao(numeroParticoes);
+    std::vector<std::vector<int>> solucao(numeroParticoes);
     for (int i = 0; i < 30; i++)
     {
-        std::list<Aresta *> arestas = coletaArestasOrdenadas(grafo);
-        std::vector<std::vector<Aresta *>> floresta(numeroParticoes);
+        std::list<int> arestas = coletaArestasOrdenadas(csr);
+        std::vector<std::vector<int>> floresta(numeroParticoes);
         std::vector<int> minimos(numeroParticoes);
         std::vector<int> maximos(numeroParticoes);
         for (int j = 0; j < numeroParticoes; j++)
         {
-            floresta[j] = std::vector<Aresta *>();
+            floresta[j] = std::vector<int>();
         }
         std::set<int> visitados = std::set<int>();
-        preencheFloresta(floresta, arestas, visitados, minimos, maximos);
-        while (visitados.size() != grafo->vertices.size())
+        preencheFloresta(csr, floresta, arestas, visitados, minimos, maximos);
+        while (visitados.size() != csr.ordem())
         {
-            adicionaNovaArestaRandomizado(floresta, arestas, visitados, alfa, minimos, maximos);
+            adicionaNovaArestaRandomizado(csr, floresta, arestas, visitados, alfa, minimos, maximos);
         }
         int gap = calculaGap(minimos, maximos);
         if (gap < melhorGap)
@@ -477,11 +491,13 @@ Grafo *Algoritmos::gulosoRandomizado(Grafo *grafo, int numeroParticoes, float al
     Grafo *grafoSolucao = new Grafo(0, 0, 1);
     for (int i = 0; i < solucao.size(); i++)
     {
-        for (Aresta *aresta : solucao[i])
+        for (int aresta : solucao[i])
         {
-            grafoSolucao->adicionaVertice(aresta->origem->id, aresta->origem->peso);
-            grafoSolucao->adicionaVertice(aresta->destino->id, aresta->destino->peso);
-            grafoSolucao->adicionaAresta(aresta->origem->id, aresta->destino->id);
+            int u = csr.origens[aresta];
+            int v = csr.destinos[aresta];
+            grafoSolucao->adicionaVertice(csr.ids[u], csr.pesosVertices[u]);
+            grafoSolucao->adicionaVertice(csr.ids[v], csr.pesosVertices[v]);
+            grafoSolucao->adicionaAresta(csr.ids[u], csr.ids[v]);
         }
     }
     return grafoSolucao;
@@ -539,6 +555,7 @@ int Algoritmos::escolheAlfa(std::vector<float> &probabilidades)
  */
 Grafo *Algoritmos::gulosoRandomizadoReativo(Grafo *grafo, int numeroParticoes)
 {
+    GrafoCSR csr = grafo->congelar();
 
     std::vector<float> alfas = {0.01, 0.1, 0.15, 0.3, 0.5};
     std::vector<float> probabilidades = {0.2, 0.2, 0.2, 0.2, 0.2};
@@ -547,12 +564,12 @@ Grafo *Algoritmos::gulosoRandomizadoReativo(Grafo *grafo, int numeroParticoes)
     int somatorioQualidades[] = {0, 0, 0, 0, 0};
 
     int melhorGap = std::numeric_limits<int>::max();
-    std::vector<std::vector<Aresta *>> solucao(numeroParticoes);
+    std::vector<std::vector<int>> solucao(numeroParticoes);
 
     for (int i = 0; i < 150; i++)
     {
-        std::list<Aresta *> arestas = coletaArestasOrdenadas(grafo);
-        std::vector<std::vector<Aresta *>> floresta(numeroParticoes);
+        std::list<int> arestas = coletaArestasOrdenadas(csr);
+        std::vector<std::vector<int>> floresta(numeroParticoes);
         std::vector<int> minimos(numeroParticoes);
         std::vector<int> maximos(numeroParticoes);
 
@@ -563,17 +580,17 @@ Grafo *Algoritmos::gulosoRandomizadoReativo(Grafo *grafo, int numeroParticoes)
 
         for (int j = 0; j < numeroParticoes; j++)
         {
-            floresta[j] = std::vector<Aresta *>();
+            floresta[j] = std::vector<int>();
         }
         std::set<int> visitados = std::set<int>();
 
         int indice = escolheAlfa(probabilidades);
 
-        preencheFloresta(floresta, arestas, visitados, minimos, maximos);
+        preencheFloresta(csr, floresta, arestas, visitados, minimos, maximos);
 
-        while (visitados.size() != grafo->vertices.size())
+        while (visitados.size() != csr.ordem())
         {
-            adicionaNovaArestaRandomizado(floresta, arestas, visitados, alfas[indice], minimos, maximos);
+            adicionaNovaArestaRandomizado(csr, floresta, arestas, visitados, alfas[indice], minimos, maximos);
         }
 
         int gap = calculaGap(minimos, maximos);
@@ -590,11 +607,13 @@ Grafo *Algoritmos::gulosoRandomizadoReativo(Grafo *grafo, int numeroParticoes)
     Grafo *grafoSolucao = new Grafo(0, 0, 1);
     for (int i = 0; i < solucao.size(); i++)
     {
-        for (Aresta *aresta : solucao[i])
+        for (int aresta : solucao[i])
         {
-            grafoSolucao->adicionaVertice(aresta->origem->id, aresta->origem->peso);
-            grafoSolucao->adicionaVertice(aresta->destino->id, aresta->destino->peso);
-            grafoSolucao->adicionaAresta(aresta->origem->id, aresta->destino->id);
+            int u = csr.origens[aresta];
+            int v = csr.destinos[aresta];
+            grafoSolucao->adicionaVertice(csr.ids[u], csr.pesosVertices[u]);
+            grafoSolucao->adicionaVertice(csr.ids[v], csr.pesosVertices[v]);
+            grafoSolucao->adicionaAresta(csr.ids[u], csr.ids[v]);
         }
     }
     return grafoSolucao;
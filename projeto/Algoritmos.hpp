@@ -12,41 +12,47 @@
 #include "Grafo.hpp"
 #include "Vertice.hpp"
 #include "Aresta.hpp"
+#include "GrafoCSR.hpp"
 
 /**
  * Algoritmos da segunda entrega do trabalho.
  */
 namespace Algoritmos
 {
-        int gapAresta(Aresta *aresta);
-        std::list<Aresta *> coletaArestasOrdenadas(Grafo *grafo);
-        int numeroDeVerticesAdjacentes(Aresta *aresta, std::set<int> &visitados);
-        bool saoAdjacentes(Aresta *e, Aresta *aresta);
-        void preencheFloresta(std::vector<std::vector<Aresta *>> &floresta,
-                std::list<Aresta *> &arestas,
+        int gapAresta(const GrafoCSR &grafo, int aresta);
+        std::list<int> coletaArestasOrdenadas(const GrafoCSR &grafo);
+        int numeroDeVerticesAdjacentes(const GrafoCSR &grafo, int aresta, std::set<int> &visitados);
+        bool saoAdjacentes(const GrafoCSR &grafo, int e, int aresta);
+        void preencheFloresta(const GrafoCSR &grafo,
+                std::vector<std::vector<int>> &floresta,
+                std::list<int> &arestas,
                 std::set<int> &visitados,
                 std::vector<int> &minimos,
                 std::vector<int> &maximos);
-        void preencheFlorestaRandomizado(std::vector<std::vector<Aresta *>> &floresta,
-                std::list<Aresta *> &arestas,
+        void preencheFlorestaRandomizado(const GrafoCSR &grafo,
+                std::vector<std::vector<int>> &floresta,
+                std::list<int> &arestas,
                 std::set<int> &visitados,
                 float alfa,
                 std::vector<int> &minimos,
                 std::vector<int> &maximos);
         int calculaGap(std::vector<int> &minimos, std::vector<int> &maximos);
 
-        int calculaImpacto(Aresta *candidata,
-                std::vector<std::vector<Aresta *>> &floresta,
+        int calculaImpacto(const GrafoCSR &grafo,
+                int candidata,
+                std::vector<std::vector<int>> &floresta,
                 std::vector<int> &minimos,
                 std::vector<int> &maximos);
-        void adicionaNovaAresta(std::vector<std::vector<Aresta *>> &floresta,
-                std::list<Aresta *> &arestas,
+        void adicionaNovaAresta(const GrafoCSR &grafo,
+                std::vector<std::vector<int>> &floresta,
+                std::list<int> &arestas,
                 std::set<int> &visitados,
                 std::vector<int> &minimos,
                 std::vector<int> &maximos);
         int geraIndiceAleatorioEntreZeroE(int max);
-        void adicionaNovaArestaRandomizado(std::vector<std::vector<Aresta *>> &floresta,
-                std::list<Aresta *> &arestas,
+        void adicionaNovaArestaRandomizado(const GrafoCSR &grafo,
+                std::vector<std::vector<int>> &floresta,
+                std::list<int> &arestas,
                 std::set<int> &visitados,
                 float alfa,
                 std::vector<int> &minimos,
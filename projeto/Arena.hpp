@@ -0,0 +1,98 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <vector>
+#include <cstddef>
+
+/**
+ * Alocador em blocos (slab) para os nós do grafo (Vertice e Aresta).
+ * Os objetos são entregues em sequência dentro de blocos contíguos, de modo que nós criados em sequência
+ * ficam vizinhos em memória. O tamanho dos blocos dobra a cada novo bloco, até o limite de TAMANHO_MAXIMO_BLOCO
+ * objetos, para que grafos pequenos (resultados de consultas) não reservem memória demais.
+ * Objetos liberados individualmente voltam para uma lista de livres e são reaproveitados; a memória
+ * só é devolvida ao sistema, de uma única vez, na destruição da arena.
+ */
+template <typename T>
+class Arena
+{
+public:
+    Arena() : usadosNoBloco(0), capacidadeBloco(0), emUso(0), picoEmUso(0), alocacoes(0), bytesReservados(0) {}
+
+    ~Arena()
+    {
+        for (T *bloco : blocos)
+        {
+            delete[] bloco;
+        }
+    }
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    T *aloca()
+    {
+        T *objeto;
+        if (!livres.empty())
+        {
+            objeto = livres.back();
+            livres.pop_back();
+        }
+        else
+        {
+            if (usadosNoBloco == capacidadeBloco)
+            {
+                novoBloco();
+            }
+            objeto = blocos.back() + usadosNoBloco;
+            usadosNoBloco++;
+        }
+        alocacoes++;
+        emUso++;
+        if (emUso > picoEmUso)
+        {
+            picoEmUso = emUso;
+        }
+        return objeto;
+    }
+
+    void libera(T *objeto)
+    {
+        livres.push_back(objeto);
+        emUso--;
+    }
+
+    long getAlocacoes() const { return alocacoes; }
+    long getEmUso() const { return emUso; }
+    long getPicoEmUso() const { return picoEmUso; }
+    long getBlocos() const { return blocos.size(); }
+    long getBytesReservados() const { return bytesReservados; }
+
+private:
+    static const int TAMANHO_MINIMO_BLOCO = 64;
+    static const int TAMANHO_MAXIMO_BLOCO = 65536;
+    std::vector<T *> blocos;
+    std::vector<T *> livres;
+    int usadosNoBloco;
+    int capacidadeBloco;
+    long emUso;
+    long picoEmUso;
+    long alocacoes;
+    long bytesReservados;
+
+    void novoBloco()
+    {
+        if (capacidadeBloco == 0)
+        {
+            capacidadeBloco = TAMANHO_MINIMO_BLOCO;
+        }
+        else if (capacidadeBloco < TAMANHO_MAXIMO_BLOCO)
+        {
+            capacidadeBloco *= 2;
+        }
+        blocos.push_back(new T[capacidadeBloco]);
+        bytesReservados += (long)capacidadeBloco * sizeof(T);
+        usadosNoBloco = 0;
+    }
+};
+
+#endif
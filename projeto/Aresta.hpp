@@ -11,6 +11,7 @@ struct Aresta
     Vertice *origem;
     Aresta *prox;
     Vertice *destino;
+    Aresta *proxEntrada; // próximo arco da lista de entrada do destino, mantida apenas com o índice de entradas ativo
 };
 
 #endif
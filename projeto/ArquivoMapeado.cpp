@@ -0,0 +1,66 @@
+#include "ArquivoMapeado.hpp"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+ArquivoMapeado::ArquivoMapeado(const std::string &caminho)
+{
+    dados = nullptr;
+    bytes = 0;
+    valido = false;
+    int descritor = open(caminho.c_str(), O_RDONLY);
+    if (descritor == -1)
+    {
+        return;
+    }
+    struct stat informacoes;
+    if (fstat(descritor, &informacoes) == 0)
+    {
+        bytes = informacoes.st_size;
+        valido = true;
+        if (bytes > 0)
+        {
+            void *mapa = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, descritor, 0);
+            if (mapa == MAP_FAILED)
+            {
+                bytes = 0;
+                valido = false;
+            }
+            else
+            {
+                madvise(mapa, bytes, MADV_SEQUENTIAL);
+                dados = static_cast<const char *>(mapa);
+            }
+        }
+    }
+    close(descritor); // o mapeamento permanece válido após o fechamento do descritor
+}
+
+ArquivoMapeado::~ArquivoMapeado()
+{
+    if (dados != nullptr)
+    {
+        munmap(const_cast<char *>(dados), bytes);
+    }
+}
+
+bool ArquivoMapeado::aberto() const
+{
+    return valido;
+}
+
+const char *ArquivoMapeado::inicio() const
+{
+    return dados;
+}
+
+const char *ArquivoMapeado::fim() const
+{
+    return dados + bytes;
+}
+
+size_t ArquivoMapeado::tamanho() const
+{
+    return bytes;
+}
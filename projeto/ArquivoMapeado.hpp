@@ -0,0 +1,29 @@
+#ifndef ARQUIVO_MAPEADO_HPP
+#define ARQUIVO_MAPEADO_HPP
+
+#include <string>
+#include <cstddef>
+
+/**
+ * Mapeia um arquivo inteiro em memória (somente leitura) durante o tempo de vida do objeto,
+ * permitindo que os leitores percorram seu conteúdo sem cópias para buffers intermediários.
+ */
+class ArquivoMapeado
+{
+public:
+    ArquivoMapeado(const std::string &caminho);
+    ~ArquivoMapeado();
+    ArquivoMapeado(const ArquivoMapeado &) = delete;
+    ArquivoMapeado &operator=(const ArquivoMapeado &) = delete;
+    bool aberto() const;
+    const char *inicio() const;
+    const char *fim() const;
+    size_t tamanho() const;
+
+private:
+    const char *dados;
+    size_t bytes;
+    bool valido;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef BARREIRA_HPP
+#define BARREIRA_HPP
+
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Barreira reutilizável para um número fixo de threads: cada chamada a espera() bloqueia até que todas
+ * as threads participantes cheguem a ela. O contador de gerações permite usar a mesma barreira em
+ * sucessivas fases de um algoritmo.
+ */
+class Barreira
+{
+public:
+    Barreira(int participantes) : participantes(participantes), aguardando(0), geracao(0) {}
+
+    Barreira(const Barreira &) = delete;
+    Barreira &operator=(const Barreira &) = delete;
+
+    void espera()
+    {
+        std::unique_lock<std::mutex> trava(mutex);
+        long geracaoChegada = geracao;
+        aguardando++;
+        if (aguardando == participantes)
+        {
+            aguardando = 0;
+            geracao++;
+            liberacao.notify_all();
+            return;
+        }
+        liberacao.wait(trava, [this, geracaoChegada] { return geracao != geracaoChegada; });
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable liberacao;
+    int participantes;
+    int aguardando;
+    long geracao;
+};
+
+#endif
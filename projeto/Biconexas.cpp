@@ -0,0 +1,99 @@
+#include "Biconexas.hpp"
+#include <algorithm>
+
+/**
+ * Preenche 'resultado' percorrendo cada componente conexa a partir do seu vértice de menor índice.
+ * Um filho v de p com minimo[v] >= tempoEntrada[p] fecha um bloco (os vértices empilhados desde v, mais p) e
+ * torna p articulação, exceto na raiz, que só é articulação com mais de um filho; com minimo[v] > tempoEntrada[p]
+ * a aresta (p, v) é ponte. Vértices isolados não formam bloco.
+ */
+void Biconexas::calcula(const GrafoCSR &csr, Resultado &resultado)
+{
+    int ordem = csr.ordem();
+    resultado.raizes.clear();
+    resultado.componentes.assign(ordem, -1);
+    resultado.articulacoes.assign(ordem, 0);
+    resultado.pontes.clear();
+    resultado.inicioBlocos.assign(1, 0);
+    resultado.verticesBlocos.clear();
+    std::vector<int> tempoEntrada(ordem, -1);
+    std::vector<int> minimo(ordem);
+    std::vector<Quadro> pilha;
+    std::vector<int> pilhaVertices;
+    int cronometro = 0;
+    for (int raiz = 0; raiz < ordem; raiz++)
+    {
+        if (tempoEntrada[raiz] != -1)
+        {
+            continue;
+        }
+        int componente = resultado.raizes.size();
+        resultado.raizes.push_back(raiz);
+        resultado.componentes[raiz] = componente;
+        tempoEntrada[raiz] = minimo[raiz] = cronometro++;
+        pilhaVertices.push_back(raiz);
+        pilha.push_back({raiz, -1, csr.inicio[raiz], false});
+        int filhosRaiz = 0;
+        while (!pilha.empty())
+        {
+            Quadro &quadro = pilha.back();
+            int v = quadro.vertice;
+            if (quadro.proximoArco < csr.inicio[v + 1])
+            {
+                int u = csr.destinos[quadro.proximoArco++];
+                if (u == quadro.pai && !quadro.paiIgnorado)
+                {
+                    quadro.paiIgnorado = true;
+                    continue;
+                }
+                if (tempoEntrada[u] != -1)
+                {
+                    minimo[v] = std::min(minimo[v], tempoEntrada[u]);
+                    continue;
+                }
+                tempoEntrada[u] = minimo[u] = cronometro++;
+                resultado.componentes[u] = componente;
+                pilhaVertices.push_back(u);
+                pilha.push_back({u, v, csr.inicio[u], false}); // invalida 'quadro'
+                continue;
+            }
+            int pai = quadro.pai;
+            pilha.pop_back();
+            if (pai == -1)
+            {
+                continue;
+            }
+            minimo[pai] = std::min(minimo[pai], minimo[v]);
+            if (minimo[v] > tempoEntrada[pai])
+            {
+                resultado.pontes.push_back(pai);
+                resultado.pontes.push_back(v);
+            }
+            if (minimo[v] >= tempoEntrada[pai])
+            {
+                if (pai == raiz)
+                {
+                    filhosRaiz++;
+                }
+                else
+                {
+                    resultado.articulacoes[pai] = 1;
+                }
+                int desempilhado;
+                do
+                {
+                    desempilhado = pilhaVertices.back();
+                    pilhaVertices.pop_back();
+                    resultado.verticesBlocos.push_back(desempilhado);
+                } while (desempilhado != v);
+                resultado.verticesBlocos.push_back(pai);
+                resultado.inicioBlocos.push_back(resultado.verticesBlocos.size());
+            }
+        }
+        pilhaVertices.clear();
+        if (filhosRaiz > 1)
+        {
+            resultado.articulacoes[raiz] = 1;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+#ifndef BICONEXAS_HPP
+#define BICONEXAS_HPP
+
+#include <vector>
+#include "GrafoCSR.hpp"
+
+/**
+ * Vértices de articulação, pontes e componentes biconexas de um grafo não-direcionado, obtidos por uma única
+ * busca em profundidade de Tarjan (tempos de entrada e menor tempo alcançável) com pilha explícita, em O(V + E).
+ * Todos os vértices são identificados pelos índices densos do CSR.
+ */
+namespace Biconexas
+{
+    struct Resultado
+    {
+        std::vector<int> raizes;             // primeiro vértice (raiz da busca) de cada componente conexa
+        std::vector<int> componentes;        // componente conexa de cada vértice (posição em raizes)
+        std::vector<char> articulacoes;      // 1 para os vértices de articulação
+        std::vector<int> pontes;             // pares (u, v) consecutivos, u pai de v na árvore de busca
+        std::vector<int> inicioBlocos;       // vértices do bloco b em [inicioBlocos[b], inicioBlocos[b + 1]) de verticesBlocos
+        std::vector<int> verticesBlocos;
+
+        int numeroBlocos() const { return inicioBlocos.size() - 1; }
+    };
+
+    /**
+     * Estado de um vértice na pilha explícita da busca: o próximo arco a examinar e se o arco de volta ao pai
+     * já foi descartado (apenas uma cópia dele é ignorada, de forma que arestas paralelas contam como ciclo).
+     */
+    struct Quadro
+    {
+        int vertice;
+        int pai;
+        int proximoArco;
+        bool paiIgnorado;
+    };
+
+    void calcula(const GrafoCSR &csr, Resultado &resultado);
+}
+
+#endif
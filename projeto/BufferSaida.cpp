@@ -0,0 +1,59 @@
+#include "BufferSaida.hpp"
+#include <charconv>
+#include <cstring>
+
+BufferSaida::BufferSaida(std::ostream &saida, size_t capacidade) : saida(saida), dados(capacidade), usados(0)
+{
+}
+
+BufferSaida::~BufferSaida()
+{
+    descarrega();
+}
+
+void BufferSaida::escreve(const char *texto)
+{
+    size_t tamanho = strlen(texto);
+    if (tamanho > dados.size())
+    {
+        descarrega();
+        saida.write(texto, tamanho);
+        return;
+    }
+    garanteEspaco(tamanho);
+    memcpy(dados.data() + usados, texto, tamanho);
+    usados += tamanho;
+}
+
+void BufferSaida::escreve(char caractere)
+{
+    garanteEspaco(1);
+    dados[usados++] = caractere;
+}
+
+void BufferSaida::escreve(int valor)
+{
+    garanteEspaco(11); // maior representação de um int de 32 bits: "-2147483648"
+    std::to_chars_result resultado = std::to_chars(dados.data() + usados, dados.data() + dados.size(), valor);
+    usados = resultado.ptr - dados.data();
+}
+
+/**
+ * Envia o conteúdo acumulado para a stream de destino numa única escrita.
+ */
+void BufferSaida::descarrega()
+{
+    if (usados > 0)
+    {
+        saida.write(dados.data(), usados);
+        usados = 0;
+    }
+}
+
+void BufferSaida::garanteEspaco(size_t bytes)
+{
+    if (usados + bytes > dados.size())
+    {
+        descarrega();
+    }
+}
@@ -0,0 +1,31 @@
+#ifndef BUFFER_SAIDA_HPP
+#define BUFFER_SAIDA_HPP
+
+#include <ostream>
+#include <vector>
+
+/**
+ * Buffer de escrita reutilizável para a geração dos arquivos de saída. Textos e números são formatados
+ * diretamente no buffer (sem strings ou streams intermediários) e enviados à stream de destino em
+ * escritas grandes, quando o buffer enche ou quando ele é descarregado/destruído.
+ */
+class BufferSaida
+{
+public:
+    BufferSaida(std::ostream &saida, size_t capacidade = 1 << 20);
+    ~BufferSaida();
+    BufferSaida(const BufferSaida &) = delete;
+    BufferSaida &operator=(const BufferSaida &) = delete;
+    void escreve(const char *texto);
+    void escreve(char caractere);
+    void escreve(int valor);
+    void descarrega();
+
+private:
+    std::ostream &saida;
+    std::vector<char> dados;
+    size_t usados;
+    void garanteEspaco(size_t bytes);
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "BuscaLargura.hpp"
+#include <algorithm>
+
+BuscaLargura::EspacoBusca &BuscaLargura::getEspacoThread()
+{
+    thread_local EspacoBusca espaco;
+    return espaco;
+}
+
+/**
+ * Busca em largura a partir do índice denso 'origem'; distâncias e predecessores ficam em 'espaco'.
+ * - reverso: fotografia com os arcos invertidos, necessária ao passo ascendente em grafos direcionados.
+ *   Em grafos não-direcionados o próprio csr é utilizado; em grafos direcionados sem 'reverso', a busca
+ *   utiliza apenas o passo descendente;
+ * - destino: se diferente de -1, a busca termina ao fim do nível em que ele é alcançado.
+ */
+void BuscaLargura::busca(const GrafoCSR &csr, const GrafoCSR *reverso, int origem, int destino, EspacoBusca &espaco)
+{
+    int ordem = csr.ordem();
+    int palavras = (ordem + 63) / 64;
+    espaco.distancias.assign(ordem, INFINITO);
+    espaco.predecessores.assign(ordem, -1);
+    espaco.visitados.assign(palavras, 0);
+    espaco.mapaFronteira.resize(palavras);
+    if (!csr.direcionado)
+    {
+        reverso = &csr;
+    }
+    espaco.distancias[origem] = 0;
+    espaco.visitados[origem / 64] |= 1ULL << (origem % 64);
+    espaco.fronteira.assign(1, origem);
+    long arcosFronteira = csr.grau(origem);
+    long arcosNaoExplorados = csr.numeroArcos() - arcosFronteira;
+    bool ascendente = false;
+    for (int nivel = 1; !espaco.fronteira.empty(); nivel++)
+    {
+        if (destino != -1 && espaco.distancias[destino] != INFINITO)
+        {
+            break;
+        }
+        if (reverso != nullptr)
+        {
+            if (!ascendente && arcosFronteira > arcosNaoExplorados / ALFA)
+            {
+                ascendente = true;
+            }
+            else if (ascendente && (long)espaco.fronteira.size() < ordem / BETA)
+            {
+                ascendente = false;
+            }
+        }
+        arcosFronteira = ascendente ? passoAscendente(csr, *reverso, nivel, espaco) : passoDescendente(csr, nivel, espaco);
+        arcosNaoExplorados -= arcosFronteira;
+        espaco.fronteira.swap(espaco.proxima);
+    }
+}
+
+/**
+ * Visita os vizinhos ainda não visitados dos vértices da fronteira. Retorna a soma dos graus da nova fronteira.
+ */
+long BuscaLargura::passoDescendente(const GrafoCSR &csr, int nivel, EspacoBusca &espaco)
+{
+    long arcos = 0;
+    espaco.proxima.clear();
+    for (int u : espaco.fronteira)
+    {
+        for (int k = csr.inicio[u]; k < csr.inicio[u + 1]; k++)
+        {
+            int v = csr.destinos[k];
+            uint64_t bit = 1ULL << (v % 64);
+            if (espaco.visitados[v / 64] & bit)
+            {
+                continue;
+            }
+            espaco.visitados[v / 64] |= bit;
+            espaco.distancias[v] = nivel;
+            espaco.predecessores[v] = u;
+            espaco.proxima.push_back(v);
+            arcos += csr.grau(v);
+        }
+    }
+    return arcos;
+}
+
+/**
+ * Cada vértice não visitado percorre seus arcos de entrada (os arcos de saída de 'reverso') até encontrar um
+ * predecessor na fronteira. Palavras do mapa de visitados com todos os bits ligados são puladas de uma vez.
+ * Retorna a soma dos graus da nova fronteira.
+ */
+long BuscaLargura::passoAscendente(const GrafoCSR &csr, const GrafoCSR &reverso, int nivel, EspacoBusca &espaco)
+{
+    int ordem = csr.ordem();
+    std::fill(espaco.mapaFronteira.begin(), espaco.mapaFronteira.end(), 0);
+    for (int u : espaco.fronteira)
+    {
+        espaco.mapaFronteira[u / 64] |= 1ULL << (u % 64);
+    }
+    long arcos = 0;
+    espaco.proxima.clear();
+    for (int palavra = 0; palavra < (int)espaco.visitados.size(); palavra++)
+    {
+        uint64_t naoVisitados = ~espaco.visitados[palavra];
+        while (naoVisitados != 0)
+        {
+            int v = palavra * 64 + __builtin_ctzll(naoVisitados);
+            naoVisitados &= naoVisitados - 1;
+            if (v >= ordem)
+            {
+                break;
+            }
+            for (int k = reverso.inicio[v]; k < reverso.inicio[v + 1]; k++)
+            {
+                int u = reverso.destinos[k];
+                if (espaco.mapaFronteira[u / 64] & (1ULL << (u % 64)))
+                {
+                    espaco.visitados[palavra] |= 1ULL << (v % 64);
+                    espaco.distancias[v] = nivel;
+                    espaco.predecessores[v] = u;
+                    espaco.proxima.push_back(v);
+                    arcos += csr.grau(v);
+                    break;
+                }
+            }
+        }
+    }
+    return arcos;
+}
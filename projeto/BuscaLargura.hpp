@@ -0,0 +1,41 @@
+#ifndef BUSCA_LARGURA_HPP
+#define BUSCA_LARGURA_HPP
+
+#include <vector>
+#include <cstdint>
+#include <limits>
+#include "GrafoCSR.hpp"
+
+/**
+ * Busca em largura sobre a fotografia CSR, utilizada como caminho mínimo em número de arestas (saltos) nos
+ * grafos sem ponderação nas arestas e nas verificações de conexidade.
+ * A busca otimiza a direção a cada nível (Beamer et al.): enquanto a fronteira é pequena, os arcos que saem
+ * dela são percorridos (passo descendente); quando ela cresce, cada vértice ainda não visitado procura um
+ * predecessor na fronteira, representada por um mapa de bits (passo ascendente), e para no primeiro encontrado.
+ */
+namespace BuscaLargura
+{
+    const int INFINITO = std::numeric_limits<int>::max();
+    const int ALFA = 14; // passa ao passo ascendente quando os arcos da fronteira superam 1/ALFA dos arcos ainda não explorados
+    const int BETA = 24; // volta ao passo descendente quando a fronteira tem menos de 1/BETA dos vértices
+
+    /**
+     * Vetores de trabalho da busca, reaproveitados entre consultas.
+     */
+    struct EspacoBusca
+    {
+        std::vector<int> distancias;   // número de saltos a partir da origem, ou INFINITO
+        std::vector<int> predecessores;
+        std::vector<int> fronteira;
+        std::vector<int> proxima;
+        std::vector<uint64_t> mapaFronteira;
+        std::vector<uint64_t> visitados;
+    };
+
+    EspacoBusca &getEspacoThread();
+    void busca(const GrafoCSR &csr, const GrafoCSR *reverso, int origem, int destino, EspacoBusca &espaco);
+    long passoDescendente(const GrafoCSR &csr, int nivel, EspacoBusca &espaco);
+    long passoAscendente(const GrafoCSR &csr, const GrafoCSR &reverso, int nivel, EspacoBusca &espaco);
+}
+
+#endif
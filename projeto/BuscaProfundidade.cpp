@@ -0,0 +1,38 @@
+#include "BuscaProfundidade.hpp"
+#include <algorithm>
+
+/**
+ * Ajusta os vetores de trabalho para um grafo de 'ordem' vértices e pinta todos de branco.
+ */
+void BuscaProfundidade::EspacoProfundidade::prepara(int ordem)
+{
+    if ((int)cor.size() < ordem)
+    {
+        cor.resize(ordem);
+    }
+    std::fill(cor.begin(), cor.begin() + ordem, BRANCO);
+    pilha.clear();
+}
+
+/**
+ * Espaço de trabalho exclusivo da thread que o solicita.
+ */
+BuscaProfundidade::EspacoProfundidade &BuscaProfundidade::getEspacoThread()
+{
+    thread_local EspacoProfundidade espaco;
+    return espaco;
+}
+
+/**
+ * Caminhamento em profundidade a partir de 'inicio', registrando a pré-ordem e os arcos de árvore e de retorno.
+ */
+void BuscaProfundidade::caminha(const GrafoCSR &csr, int inicio, Caminhamento &caminhamento)
+{
+    caminhamento.ordem.clear();
+    caminhamento.arcosArvore.clear();
+    caminhamento.arcosRetorno.clear();
+    EspacoProfundidade &espaco = getEspacoThread();
+    espaco.prepara(csr.ordem());
+    RegistraCaminhamento registro(caminhamento);
+    percorre(csr, inicio, espaco, registro);
+}
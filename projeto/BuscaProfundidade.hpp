@@ -0,0 +1,111 @@
+#ifndef BUSCA_PROFUNDIDADE_HPP
+#define BUSCA_PROFUNDIDADE_HPP
+
+#include <vector>
+#include "GrafoCSR.hpp"
+
+/**
+ * Busca em profundidade iterativa sobre a fotografia CSR do grafo, com pilha explícita e um byte de cor por vértice,
+ * de modo que caminhos profundos não esgotam a pilha de chamadas. Quem chama recebe os eventos da busca através de
+ * um visitante com os métodos preOrdem(u), posOrdem(u), arcoArvore(k) e arcoRetorno(k), em que k é a posição do arco
+ * no CSR; VisitanteVazio fornece versões vazias de todos eles.
+ */
+namespace BuscaProfundidade
+{
+    const unsigned char BRANCO = 0; // ainda não descoberto
+    const unsigned char CINZA = 1;  // descoberto e ainda na pilha
+    const unsigned char PRETO = 2;  // finalizado
+
+    struct Quadro
+    {
+        int vertice;
+        int proximoArco;
+    };
+
+    /**
+     * Vetores de trabalho reaproveitados entre buscas: depois de atingirem o tamanho do maior grafo percorrido,
+     * novas buscas não alocam memória.
+     */
+    struct EspacoProfundidade
+    {
+        std::vector<unsigned char> cor;
+        std::vector<Quadro> pilha;
+
+        void prepara(int ordem);
+    };
+
+    struct VisitanteVazio
+    {
+        void preOrdem(int) {}
+        void posOrdem(int) {}
+        void arcoArvore(int) {}
+        void arcoRetorno(int) {}
+    };
+
+    /**
+     * Resultado de um caminhamento: vértices na ordem de descoberta e as posições no CSR dos arcos da árvore e dos
+     * arcos de retorno (que chegam a um vértice ainda na pilha), cada lista na ordem em que os arcos foram percorridos.
+     */
+    struct Caminhamento
+    {
+        std::vector<int> ordem;
+        std::vector<int> arcosArvore;
+        std::vector<int> arcosRetorno;
+    };
+
+    struct RegistraCaminhamento : VisitanteVazio
+    {
+        Caminhamento &caminhamento;
+
+        RegistraCaminhamento(Caminhamento &caminhamento) : caminhamento(caminhamento) {}
+        void preOrdem(int u) { caminhamento.ordem.push_back(u); }
+        void arcoArvore(int k) { caminhamento.arcosArvore.push_back(k); }
+        void arcoRetorno(int k) { caminhamento.arcosRetorno.push_back(k); }
+    };
+
+    EspacoProfundidade &getEspacoThread();
+    void caminha(const GrafoCSR &csr, int inicio, Caminhamento &caminhamento);
+
+    /**
+     * Percorre em profundidade os vértices alcançáveis a partir de 'inicio' que ainda estejam brancos em espaco.cor.
+     * As cores não são reiniciadas, então buscas sucessivas sobre o mesmo espaço formam uma floresta; para uma
+     * busca isolada, chame espaco.prepara antes.
+     */
+    template <typename Visitante>
+    void percorre(const GrafoCSR &csr, int inicio, EspacoProfundidade &espaco, Visitante &visitante)
+    {
+        std::vector<unsigned char> &cor = espaco.cor;
+        std::vector<Quadro> &pilha = espaco.pilha;
+        pilha.clear();
+        cor[inicio] = CINZA;
+        visitante.preOrdem(inicio);
+        pilha.push_back({inicio, csr.inicio[inicio]});
+        while (!pilha.empty())
+        {
+            Quadro &topo = pilha.back();
+            int u = topo.vertice;
+            if (topo.proximoArco == csr.inicio[u + 1])
+            {
+                cor[u] = PRETO;
+                visitante.posOrdem(u);
+                pilha.pop_back();
+                continue;
+            }
+            int k = topo.proximoArco++;
+            int v = csr.destinos[k];
+            if (cor[v] == BRANCO)
+            {
+                visitante.arcoArvore(k);
+                cor[v] = CINZA;
+                visitante.preOrdem(v);
+                pilha.push_back({v, csr.inicio[v]}); // pode realocar a pilha: 'topo' não é mais usado
+            }
+            else if (cor[v] == CINZA)
+            {
+                visitante.arcoRetorno(k);
+            }
+        }
+    }
+}
+
+#endif
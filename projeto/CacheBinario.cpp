@@ -0,0 +1,228 @@
+#include "CacheBinario.hpp"
+#include <cstring>
+#include <cstdint>
+#include <sys/stat.h>
+
+const char ASSINATURA[8] = {'G', 'R', 'A', 'F', 'O', 'C', 'S', 'R'};
+const int32_t VERSAO = 1;
+
+void CacheBinario::escreveVetor(std::ofstream &arquivo, const std::vector<int> &vetor)
+{
+    arquivo.write(reinterpret_cast<const char *>(vetor.data()), vetor.size() * sizeof(int32_t));
+}
+
+const char *CacheBinario::leVetor(const char *cursor, std::vector<int> &vetor, int tamanho)
+{
+    vetor.resize(tamanho);
+    memcpy(vetor.data(), cursor, tamanho * sizeof(int32_t));
+    return cursor + tamanho * sizeof(int32_t);
+}
+
+/**
+ * Lê o cabeçalho do arquivo mapeado e confere assinatura, versão e se o tamanho do arquivo corresponde
+ * exatamente à ordem e ao número de arcos declarados.
+ */
+bool CacheBinario::leCabecalho(const ArquivoMapeado &arquivo, Cabecalho &cabecalho)
+{
+    if (!arquivo.aberto() || arquivo.tamanho() < sizeof(Cabecalho))
+    {
+        return false;
+    }
+    memcpy(&cabecalho, arquivo.inicio(), sizeof(Cabecalho));
+    if (memcmp(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 || cabecalho.versao != VERSAO)
+    {
+        return false;
+    }
+    if (cabecalho.ordem < 0 || cabecalho.arcos < 0)
+    {
+        return false;
+    }
+    size_t esperado = sizeof(Cabecalho) + sizeof(int32_t) * (3 * (size_t)cabecalho.ordem + 1 + 2 * (size_t)cabecalho.arcos);
+    return arquivo.tamanho() == esperado;
+}
+
+/**
+ * Resumo (FNV-1a de 64 bits) da estrutura do grafo, gravado nos arquivos de índices para que eles só sejam
+ * carregados no mesmo grafo em que foram calculados.
+ */
+uint64_t CacheBinario::impressaoDigital(const GrafoCSR &csr)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    auto acumula = [&hash](const std::vector<int> &vetor)
+    {
+        for (int valor : vetor)
+        {
+            hash = (hash ^ (uint32_t)valor) * 1099511628211ULL;
+        }
+    };
+    hash = (hash ^ (uint64_t)csr.direcionado) * 1099511628211ULL;
+    acumula(csr.ids);
+    acumula(csr.inicio);
+    acumula(csr.destinos);
+    acumula(csr.pesos);
+    return hash;
+}
+
+/**
+ * Preenche o prefixo comum do cabeçalho de um arquivo de índice calculado sobre 'csr'.
+ */
+void CacheBinario::preencheIndice(CabecalhoIndice &cabecalho, const char assinatura[8], int32_t versao, const GrafoCSR &csr)
+{
+    memset(&cabecalho, 0, sizeof(CabecalhoIndice));
+    memcpy(cabecalho.assinatura, assinatura, sizeof(cabecalho.assinatura));
+    cabecalho.versao = versao;
+    cabecalho.direcionado = csr.direcionado;
+    cabecalho.ordem = csr.ordem();
+    cabecalho.arcos = csr.numeroArcos();
+    cabecalho.impressao = impressaoDigital(csr);
+}
+
+/**
+ * Copia para 'cabecalho' os primeiros 'tamanhoCabecalho' bytes do arquivo mapeado, que devem começar por um
+ * CabecalhoIndice, e confere assinatura, versão e se o índice foi calculado sobre 'csr'. Retorna o início do
+ * conteúdo que segue o cabeçalho, ou nullptr caso o arquivo não exista, seja menor que o cabeçalho ou não
+ * corresponda ao grafo; o tamanho exato do conteúdo fica a cargo de quem chama.
+ */
+const char *CacheBinario::abreIndice(const ArquivoMapeado &arquivo, const char assinatura[8], int32_t versao, const GrafoCSR &csr, void *cabecalho, size_t tamanhoCabecalho)
+{
+    if (!arquivo.aberto() || arquivo.tamanho() < tamanhoCabecalho)
+    {
+        return nullptr;
+    }
+    memcpy(cabecalho, arquivo.inicio(), tamanhoCabecalho);
+    CabecalhoIndice lido;
+    memcpy(&lido, cabecalho, sizeof(CabecalhoIndice));
+    if (memcmp(lido.assinatura, assinatura, sizeof(lido.assinatura)) != 0 || lido.versao != versao)
+    {
+        return nullptr;
+    }
+    if (lido.direcionado != csr.direcionado || lido.ordem != csr.ordem() || lido.arcos != csr.numeroArcos() ||
+        lido.impressao != impressaoDigital(csr))
+    {
+        return nullptr;
+    }
+    return arquivo.inicio() + tamanhoCabecalho;
+}
+
+/**
+ * Retorna o instante da última modificação do arquivo, em nanossegundos, ou -1 caso ele não exista.
+ */
+long CacheBinario::getModificacao(const std::string &caminho)
+{
+    struct stat informacoes;
+    if (stat(caminho.c_str(), &informacoes) != 0)
+    {
+        return -1;
+    }
+    return informacoes.st_mtim.tv_sec * 1000000000L + informacoes.st_mtim.tv_nsec;
+}
+
+/**
+ * Caminho convencional do cache de uma instância: o próprio caminho da instância acrescido de ".bin".
+ */
+std::string CacheBinario::getCaminhoCache(const std::string &caminhoInstancia)
+{
+    return caminhoInstancia + ".bin";
+}
+
+/**
+ * Grava o CSR e o número de partições no arquivo de cache. Retorna false caso a escrita falhe.
+ */
+bool CacheBinario::salvar(const GrafoCSR &csr, int particoes, const std::string &caminhoCache)
+{
+    std::ofstream arquivo(caminhoCache, std::ios::binary | std::ios::trunc);
+    if (!arquivo)
+    {
+        return false;
+    }
+    Cabecalho cabecalho;
+    memcpy(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA));
+    cabecalho.versao = VERSAO;
+    cabecalho.direcionado = csr.direcionado;
+    cabecalho.arestasPonderadas = csr.arestasPonderadas;
+    cabecalho.verticesPonderados = csr.verticesPonderados;
+    cabecalho.reservado = 0;
+    cabecalho.particoes = particoes;
+    cabecalho.ordem = csr.ordem();
+    cabecalho.arcos = csr.numeroArcos();
+    arquivo.write(reinterpret_cast<const char *>(&cabecalho), sizeof(Cabecalho));
+    escreveVetor(arquivo, csr.ids);
+    escreveVetor(arquivo, csr.pesosVertices);
+    escreveVetor(arquivo, csr.inicio);
+    escreveVetor(arquivo, csr.destinos);
+    escreveVetor(arquivo, csr.pesos);
+    return (bool)arquivo;
+}
+
+/**
+ * Carrega o cache mapeando o arquivo em memória e copiando cada vetor do CSR de uma só vez.
+ * Retorna false (sem alterar csr) caso o arquivo não exista, esteja truncado ou tenha formato inválido,
+ * inclusive ids de vértices repetidos.
+ */
+bool CacheBinario::carregar(const std::string &caminhoCache, GrafoCSR &csr, int &particoes)
+{
+    ArquivoMapeado arquivo(caminhoCache);
+    Cabecalho cabecalho;
+    if (!leCabecalho(arquivo, cabecalho))
+    {
+        return false;
+    }
+    GrafoCSR lido;
+    lido.direcionado = cabecalho.direcionado;
+    lido.arestasPonderadas = cabecalho.arestasPonderadas;
+    lido.verticesPonderados = cabecalho.verticesPonderados;
+    const char *cursor = arquivo.inicio() + sizeof(Cabecalho);
+    cursor = leVetor(cursor, lido.ids, cabecalho.ordem);
+    cursor = leVetor(cursor, lido.pesosVertices, cabecalho.ordem);
+    cursor = leVetor(cursor, lido.inicio, cabecalho.ordem + 1);
+    cursor = leVetor(cursor, lido.destinos, cabecalho.arcos);
+    cursor = leVetor(cursor, lido.pesos, cabecalho.arcos);
+    if (lido.inicio[0] != 0 || lido.inicio[cabecalho.ordem] != cabecalho.arcos)
+    {
+        return false;
+    }
+    lido.origens.resize(cabecalho.arcos);
+    lido.indices.reserve(cabecalho.ordem);
+    for (int i = 0; i < cabecalho.ordem; i++)
+    {
+        if (lido.inicio[i] > lido.inicio[i + 1])
+        {
+            return false;
+        }
+        for (int k = lido.inicio[i]; k < lido.inicio[i + 1]; k++)
+        {
+            if (lido.destinos[k] < 0 || lido.destinos[k] >= cabecalho.ordem)
+            {
+                return false;
+            }
+            lido.origens[k] = i;
+        }
+        if (!lido.indices.emplace(lido.ids[i], i).second)
+        {
+            return false; // id repetido: o grafo reconstruído teria menos vértices que o CSR
+        }
+    }
+    csr = std::move(lido);
+    particoes = cabecalho.particoes;
+    return true;
+}
+
+/**
+ * Retorna true se existe um cache íntegro mais recente que a instância e gerado com as mesmas flags de grafo.
+ */
+bool CacheBinario::cacheValido(const std::string &caminhoCache, const std::string &caminhoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados)
+{
+    long modificacaoCache = getModificacao(caminhoCache);
+    long modificacaoInstancia = getModificacao(caminhoInstancia);
+    if (modificacaoCache == -1 || modificacaoInstancia == -1 || modificacaoCache <= modificacaoInstancia)
+    {
+        return false;
+    }
+    ArquivoMapeado arquivo(caminhoCache);
+    Cabecalho cabecalho;
+    if (!leCabecalho(arquivo, cabecalho))
+    {
+        return false;
+    }
+    return cabecalho.direcionado == direcionado && cabecalho.arestasPonderadas == arestasPonderadas && cabecalho.verticesPonderados == verticesPonderados;
+}
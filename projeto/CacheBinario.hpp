@@ -0,0 +1,59 @@
+#ifndef CACHE_BINARIO_HPP
+#define CACHE_BINARIO_HPP
+
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include "GrafoCSR.hpp"
+#include "ArquivoMapeado.hpp"
+
+/**
+ * Formato binário compacto para guardar um grafo já processado e evitar reler a instância textual.
+ * O arquivo contém um cabeçalho fixo (assinatura, versão, flags do grafo, número de partições do MGGPP,
+ * ordem e número de arcos) seguido dos vetores ids, pesosVertices, inicio, destinos e pesos do CSR,
+ * todos como inteiros de 32 bits na ordem de bytes da máquina.
+ */
+namespace CacheBinario
+{
+    struct Cabecalho
+    {
+        char assinatura[8];
+        int32_t versao;
+        uint8_t direcionado;
+        uint8_t arestasPonderadas;
+        uint8_t verticesPonderados;
+        uint8_t reservado;
+        int32_t particoes;
+        int32_t ordem;
+        int32_t arcos;
+    };
+
+    /**
+     * Prefixo comum dos arquivos de índices derivados do grafo (marcos, hierarquia de contração, fecho transitivo e
+     * índice de alcançabilidade). Cada módulo grava este prefixo no início do seu cabeçalho, seguido dos próprios campos.
+     */
+    struct CabecalhoIndice
+    {
+        char assinatura[8];
+        int32_t versao;
+        uint8_t direcionado;
+        uint8_t reservado[3];
+        int32_t ordem;
+        int32_t arcos;
+        uint64_t impressao;
+    };
+
+    std::string getCaminhoCache(const std::string &caminhoInstancia);
+    bool salvar(const GrafoCSR &csr, int particoes, const std::string &caminhoCache);
+    bool carregar(const std::string &caminhoCache, GrafoCSR &csr, int &particoes);
+    void escreveVetor(std::ofstream &arquivo, const std::vector<int> &vetor);
+    const char *leVetor(const char *cursor, std::vector<int> &vetor, int tamanho);
+    bool leCabecalho(const ArquivoMapeado &arquivo, Cabecalho &cabecalho);
+    long getModificacao(const std::string &caminho);
+    uint64_t impressaoDigital(const GrafoCSR &csr);
+    void preencheIndice(CabecalhoIndice &cabecalho, const char assinatura[8], int32_t versao, const GrafoCSR &csr);
+    const char *abreIndice(const ArquivoMapeado &arquivo, const char assinatura[8], int32_t versao, const GrafoCSR &csr, void *cabecalho, size_t tamanhoCabecalho);
+    bool cacheValido(const std::string &caminhoCache, const std::string &caminhoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados);
+}
+
+#endif
@@ -0,0 +1,337 @@
+#include "CaminhoBidirecional.hpp"
+#include "CacheBinario.hpp"
+#include "ArquivoMapeado.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+
+const char ASSINATURA_MARCOS[8] = {'M', 'A', 'R', 'C', 'O', 'S', 'A', 'L'};
+const int32_t VERSAO_MARCOS = 2;
+
+/**
+ * Limite inferior da distância de v até 'destino' pela desigualdade triangular:
+ * d(v, t) >= d(m, t) - d(m, v) e d(v, t) >= d(v, m) - d(t, m) para todo marco m.
+ * Retorna INFINITO quando as tabelas provam que v não alcança o destino.
+ */
+int CaminhoBidirecional::Marcos::limiteAte(int v, int destino) const
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int limite = 0;
+    for (int m = 0; m < quantidade(); m++)
+    {
+        int deMarcoV = de(m, v);
+        int deMarcoDestino = de(m, destino);
+        if (deMarcoV != INFINITO)
+        {
+            if (deMarcoDestino == INFINITO)
+            {
+                return INFINITO; // o marco alcança v mas não o destino
+            }
+            limite = std::max(limite, deMarcoDestino - deMarcoV);
+        }
+        int deVParaMarco = para(m, v);
+        int doDestinoParaMarco = para(m, destino);
+        if (doDestinoParaMarco != INFINITO)
+        {
+            if (deVParaMarco == INFINITO)
+            {
+                return INFINITO; // o destino alcança o marco mas v não
+            }
+            limite = std::max(limite, deVParaMarco - doDestinoParaMarco);
+        }
+    }
+    return limite;
+}
+
+/**
+ * Limite inferior da distância de 'origem' até v, simétrico a limiteAte:
+ * d(s, v) >= d(m, v) - d(m, s) e d(s, v) >= d(s, m) - d(v, m).
+ */
+int CaminhoBidirecional::Marcos::limiteDesde(int origem, int v) const
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int limite = 0;
+    for (int m = 0; m < quantidade(); m++)
+    {
+        int deMarcoOrigem = de(m, origem);
+        int deMarcoV = de(m, v);
+        if (deMarcoOrigem != INFINITO)
+        {
+            if (deMarcoV == INFINITO)
+            {
+                return INFINITO; // o marco alcança a origem mas não v
+            }
+            limite = std::max(limite, deMarcoV - deMarcoOrigem);
+        }
+        int daOrigemParaMarco = para(m, origem);
+        int deVParaMarco = para(m, v);
+        if (deVParaMarco != INFINITO)
+        {
+            if (daOrigemParaMarco == INFINITO)
+            {
+                return INFINITO; // v alcança o marco mas a origem não
+            }
+            limite = std::max(limite, daOrigemParaMarco - deVParaMarco);
+        }
+    }
+    return limite;
+}
+
+CaminhoBidirecional::EspacoBidirecional &CaminhoBidirecional::getEspacoThread()
+{
+    thread_local EspacoBidirecional espaco;
+    return espaco;
+}
+
+/**
+ * Escolhe até 'quantidade' marcos pela heurística do mais distante: o primeiro é o vértice mais distante do
+ * vértice 0 e cada marco seguinte é o vértice mais distante dos marcos já escolhidos (vértices que nenhum
+ * marco alcança têm prioridade, de forma que componentes diferentes recebem marcos). Para cada marco são
+ * calculadas as distâncias a partir dele e, em grafos direcionados, sobre 'reverso', as distâncias até ele.
+ */
+void CaminhoBidirecional::escolheMarcos(const GrafoCSR &csr, const GrafoCSR &reverso, int quantidade, Marcos &marcos)
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int ordem = csr.ordem();
+    marcos.ordem = ordem;
+    marcos.direcionado = csr.direcionado;
+    marcos.vertices.clear();
+    marcos.distanciasDe.clear();
+    marcos.distanciasPara.clear();
+    quantidade = std::min(quantidade, ordem);
+    if (quantidade <= 0)
+    {
+        return;
+    }
+    CaminhoMinimo::EspacoDijkstra &espaco = CaminhoMinimo::getEspacoThread();
+    CaminhoMinimo::dijkstra(csr, 0, espaco);
+    int candidato = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        if (espaco.distancia(v) != INFINITO && espaco.distancia(v) > espaco.distancia(candidato))
+        {
+            candidato = v;
+        }
+    }
+    std::vector<long> proximidade(ordem, LONG_MAX); // menor distância de cada vértice aos marcos já escolhidos
+    std::vector<bool> escolhido(ordem, false);
+    marcos.distanciasDe.resize((size_t)quantidade * ordem);
+    if (marcos.direcionado)
+    {
+        marcos.distanciasPara.resize((size_t)quantidade * ordem);
+    }
+    for (int m = 0; m < quantidade; m++)
+    {
+        marcos.vertices.push_back(candidato);
+        escolhido[candidato] = true;
+        CaminhoMinimo::dijkstra(csr, candidato, espaco);
+        for (int v = 0; v < ordem; v++)
+        {
+            marcos.distanciasDe[(size_t)m * ordem + v] = espaco.distancia(v);
+        }
+        if (marcos.direcionado)
+        {
+            CaminhoMinimo::dijkstra(reverso, candidato, espaco);
+            for (int v = 0; v < ordem; v++)
+            {
+                marcos.distanciasPara[(size_t)m * ordem + v] = espaco.distancia(v);
+            }
+        }
+        int proximo = -1;
+        for (int v = 0; v < ordem; v++)
+        {
+            int distancia = std::min(marcos.de(m, v), marcos.para(m, v));
+            if (distancia != INFINITO)
+            {
+                proximidade[v] = std::min(proximidade[v], (long)distancia);
+            }
+            if (!escolhido[v] && (proximo == -1 || proximidade[v] > proximidade[proximo]))
+            {
+                proximo = v;
+            }
+        }
+        if (proximo == -1)
+        {
+            break;
+        }
+        candidato = proximo;
+    }
+    int escolhidos = marcos.vertices.size();
+    marcos.distanciasDe.resize((size_t)escolhidos * ordem);
+    if (marcos.direcionado)
+    {
+        marcos.distanciasPara.resize((size_t)escolhidos * ordem);
+    }
+}
+
+/**
+ * Grava as tabelas de marcos: cabeçalho fixo seguido dos vértices marcos e das tabelas distanciasDe e, em
+ * grafos direcionados, distanciasPara, como inteiros de 32 bits na ordem de bytes da máquina.
+ * Retorna false caso a escrita falhe.
+ */
+bool CaminhoBidirecional::salvaMarcos(const Marcos &marcos, const GrafoCSR &csr, const std::string &caminho)
+{
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo)
+    {
+        return false;
+    }
+    CabecalhoMarcos cabecalho;
+    memset(&cabecalho, 0, sizeof(CabecalhoMarcos));
+    CacheBinario::preencheIndice(cabecalho.indice, ASSINATURA_MARCOS, VERSAO_MARCOS, csr);
+    cabecalho.quantidade = marcos.quantidade();
+    arquivo.write(reinterpret_cast<const char *>(&cabecalho), sizeof(CabecalhoMarcos));
+    CacheBinario::escreveVetor(arquivo, marcos.vertices);
+    CacheBinario::escreveVetor(arquivo, marcos.distanciasDe);
+    CacheBinario::escreveVetor(arquivo, marcos.distanciasPara);
+    return (bool)arquivo;
+}
+
+/**
+ * Carrega tabelas de marcos gravadas por salvaMarcos; 'marcos' só é alterado se o arquivo for válido para 'csr'.
+ */
+bool CaminhoBidirecional::carregaMarcos(const std::string &caminho, const GrafoCSR &csr, Marcos &marcos)
+{
+    ArquivoMapeado arquivo(caminho);
+    CabecalhoMarcos cabecalho;
+    const char *cursor = CacheBinario::abreIndice(arquivo, ASSINATURA_MARCOS, VERSAO_MARCOS, csr, &cabecalho, sizeof(CabecalhoMarcos));
+    if (cursor == nullptr || cabecalho.quantidade < 0)
+    {
+        return false;
+    }
+    size_t tabela = (size_t)cabecalho.quantidade * csr.ordem();
+    size_t esperado = sizeof(CabecalhoMarcos) + sizeof(int32_t) * (cabecalho.quantidade + tabela * (csr.direcionado ? 2 : 1));
+    if (arquivo.tamanho() != esperado)
+    {
+        return false;
+    }
+    Marcos lidos;
+    lidos.ordem = csr.ordem();
+    lidos.direcionado = csr.direcionado;
+    cursor = CacheBinario::leVetor(cursor, lidos.vertices, cabecalho.quantidade);
+    cursor = CacheBinario::leVetor(cursor, lidos.distanciasDe, tabela);
+    if (lidos.direcionado)
+    {
+        cursor = CacheBinario::leVetor(cursor, lidos.distanciasPara, tabela);
+    }
+    for (int vertice : lidos.vertices)
+    {
+        if (vertice < 0 || vertice >= lidos.ordem)
+        {
+            return false;
+        }
+    }
+    marcos = std::move(lidos);
+    return true;
+}
+
+/**
+ * Fecha o vértice u de um dos lados da busca e relaxa seus arcos em 'grafo' (o próprio grafo para a busca a
+ * partir da origem, o reverso para a busca a partir do destino). A chave de cada vértice no heap é sua
+ * distância somada ao limite inferior da distância restante até 'alvo' (zero sem marcos); vértices que as
+ * tabelas provam não pertencer a nenhum caminho são descartados. Atualiza 'melhor' e 'encontro' sempre que
+ * um vértice já alcançado pelo outro lado forma um caminho mais curto.
+ */
+void CaminhoBidirecional::relaxa(const GrafoCSR &grafo, int u, CaminhoMinimo::EspacoDijkstra &lado, const CaminhoMinimo::EspacoDijkstra &outroLado,
+                                 const Marcos *marcos, int alvo, bool frente, long &melhor, int &encontro)
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int distanciaU = lado.distancias[u];
+    for (int k = grafo.inicio[u]; k < grafo.inicio[u + 1]; k++)
+    {
+        int v = grafo.destinos[k];
+        int distancia = distanciaU + grafo.pesos[k];
+        if (distancia >= lado.distancia(v))
+        {
+            continue;
+        }
+        int limite = 0;
+        if (marcos != nullptr)
+        {
+            limite = frente ? marcos->limiteAte(v, alvo) : marcos->limiteDesde(alvo, v);
+            if (limite == INFINITO)
+            {
+                continue;
+            }
+        }
+        lado.geracoes[v] = lado.geracaoAtual;
+        lado.distancias[v] = distancia;
+        lado.predecessores[v] = u;
+        lado.heap.insereOuDiminui(v, (int)std::min((long)distancia + limite, (long)INFINITO - 1));
+        if (outroLado.alcancado(v) && (long)distancia + outroLado.distancias[v] < melhor)
+        {
+            melhor = (long)distancia + outroLado.distancias[v];
+            encontro = v;
+        }
+    }
+}
+
+/**
+ * Calcula o caminho mínimo entre os índices densos 'origem' e 'destino', com 'reverso' sendo o grafo transposto
+ * (o próprio csr em grafos não-direcionados) e 'marcos' as tabelas ALT, ou nullptr para o Dijkstra bidirecional
+ * puro. Preenche 'caminho' com os índices da origem ao destino e retorna o custo, ou INFINITO se não houver caminho.
+ * Critérios de parada: sem marcos, a soma dos topos dos dois heaps alcança o melhor caminho conhecido; com marcos
+ * (abordagem simétrica de Goldberg e Harrelson), o topo de qualquer um dos heaps o alcança.
+ */
+int CaminhoBidirecional::busca(const GrafoCSR &csr, const GrafoCSR &reverso, const Marcos *marcos, int origem, int destino, std::vector<int> &caminho)
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    caminho.clear();
+    if (origem == destino)
+    {
+        caminho.push_back(origem);
+        return 0;
+    }
+    EspacoBidirecional &espaco = getEspacoThread();
+    CaminhoMinimo::EspacoDijkstra &frente = espaco.frente;
+    CaminhoMinimo::EspacoDijkstra &tras = espaco.tras;
+    frente.prepara(csr.ordem());
+    tras.prepara(csr.ordem());
+    if (marcos != nullptr && marcos->limiteAte(origem, destino) == INFINITO)
+    {
+        return INFINITO;
+    }
+    frente.geracoes[origem] = frente.geracaoAtual;
+    frente.distancias[origem] = 0;
+    frente.predecessores[origem] = -1;
+    frente.heap.insereOuDiminui(origem, 0);
+    tras.geracoes[destino] = tras.geracaoAtual;
+    tras.distancias[destino] = 0;
+    tras.predecessores[destino] = -1;
+    tras.heap.insereOuDiminui(destino, 0);
+    long melhor = LONG_MAX;
+    int encontro = -1;
+    while (!frente.heap.vazio() && !tras.heap.vazio())
+    {
+        long topoFrente = frente.heap.chaveMinima();
+        long topoTras = tras.heap.chaveMinima();
+        bool termina = marcos != nullptr ? (topoFrente >= melhor || topoTras >= melhor) : topoFrente + topoTras >= melhor;
+        if (termina)
+        {
+            break;
+        }
+        if (topoFrente <= topoTras)
+        {
+            relaxa(csr, frente.heap.removeMinimo(), frente, tras, marcos, destino, true, melhor, encontro);
+        }
+        else
+        {
+            relaxa(reverso, tras.heap.removeMinimo(), tras, frente, marcos, origem, false, melhor, encontro);
+        }
+    }
+    if (encontro == -1)
+    {
+        return INFINITO;
+    }
+    for (int atual = encontro; atual != -1; atual = frente.predecessor(atual))
+    {
+        caminho.push_back(atual);
+    }
+    std::reverse(caminho.begin(), caminho.end());
+    for (int atual = tras.predecessor(encontro); atual != -1; atual = tras.predecessor(atual))
+    {
+        caminho.push_back(atual);
+    }
+    return melhor;
+}
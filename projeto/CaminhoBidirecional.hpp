@@ -0,0 +1,65 @@
+#ifndef CAMINHO_BIDIRECIONAL_HPP
+#define CAMINHO_BIDIRECIONAL_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "GrafoCSR.hpp"
+#include "CaminhoMinimo.hpp"
+#include "CacheBinario.hpp"
+
+/**
+ * Caminho mínimo entre um par de vértices por Dijkstra bidirecional: uma busca parte da origem sobre os arcos
+ * do grafo e outra parte do destino sobre os arcos reversos, até que nenhuma delas possa melhorar o melhor
+ * caminho já encontrado pelo encontro das duas. Opcionalmente as buscas são guiadas por marcos (ALT: A*,
+ * landmarks e desigualdade triangular): distâncias pré-calculadas de/para alguns vértices fornecem limites
+ * inferiores das distâncias restantes, o que poda a maior parte do grafo em consultas distantes.
+ * Exige que o grafo não possua arcos de peso negativo.
+ */
+namespace CaminhoBidirecional
+{
+    /**
+     * Tabelas de distâncias dos marcos. Para o marco m e o vértice v, distanciasDe[m * ordem + v] é a distância
+     * do marco até v e distanciasPara[m * ordem + v] a distância de v até o marco (vazio em grafos não-direcionados,
+     * em que ambas coincidem).
+     */
+    struct Marcos
+    {
+        int ordem = 0;
+        bool direcionado = false;
+        std::vector<int> vertices;
+        std::vector<int> distanciasDe;
+        std::vector<int> distanciasPara;
+
+        int quantidade() const { return vertices.size(); }
+        int de(int marco, int v) const { return distanciasDe[(size_t)marco * ordem + v]; }
+        int para(int marco, int v) const { return direcionado ? distanciasPara[(size_t)marco * ordem + v] : de(marco, v); }
+        int limiteAte(int v, int destino) const;
+        int limiteDesde(int origem, int v) const;
+    };
+
+    struct CabecalhoMarcos
+    {
+        CacheBinario::CabecalhoIndice indice;
+        int32_t quantidade;
+    };
+
+    /**
+     * Vetores de trabalho das duas buscas, reaproveitados entre consultas da mesma thread.
+     */
+    struct EspacoBidirecional
+    {
+        CaminhoMinimo::EspacoDijkstra frente;
+        CaminhoMinimo::EspacoDijkstra tras;
+    };
+
+    EspacoBidirecional &getEspacoThread();
+    void escolheMarcos(const GrafoCSR &csr, const GrafoCSR &reverso, int quantidade, Marcos &marcos);
+    bool salvaMarcos(const Marcos &marcos, const GrafoCSR &csr, const std::string &caminho);
+    bool carregaMarcos(const std::string &caminho, const GrafoCSR &csr, Marcos &marcos);
+    int busca(const GrafoCSR &csr, const GrafoCSR &reverso, const Marcos *marcos, int origem, int destino, std::vector<int> &caminho);
+    void relaxa(const GrafoCSR &grafo, int u, CaminhoMinimo::EspacoDijkstra &lado, const CaminhoMinimo::EspacoDijkstra &outroLado,
+                const Marcos *marcos, int alvo, bool frente, long &melhor, int &encontro);
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "CaminhoMinimo.hpp"
+
+/**
+ * Ajusta os vetores de trabalho para um grafo de 'ordem' vértices e inicia uma nova geração.
+ */
+void CaminhoMinimo::EspacoDijkstra::prepara(int ordem)
+{
+    if ((int)distancias.size() < ordem)
+    {
+        distancias.resize(ordem);
+        predecessores.resize(ordem);
+        geracoes.resize(ordem, 0);
+    }
+    heap.redimensiona(ordem);
+    heap.limpa();
+    geracaoAtual++;
+    if (geracaoAtual == 0) // o contador deu a volta: marcas antigas poderiam ser confundidas com a nova geração
+    {
+        std::fill(geracoes.begin(), geracoes.end(), 0);
+        geracaoAtual = 1;
+    }
+}
+
+/**
+ * Espaço de trabalho exclusivo da thread que o solicita; consultas sucessivas na mesma thread não alocam memória
+ * depois que o espaço atinge o tamanho do maior grafo consultado.
+ */
+CaminhoMinimo::EspacoDijkstra &CaminhoMinimo::getEspacoThread()
+{
+    thread_local EspacoDijkstra espaco;
+    return espaco;
+}
+
+bool CaminhoMinimo::possuiPesosNegativos(const GrafoCSR &csr)
+{
+    for (int peso : csr.pesos)
+    {
+        if (peso < 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Dijkstra com heap binário indexado a partir do índice denso 'origem'. As distâncias e os predecessores
+ * ficam em 'espaco'. Com arcos negativos, um vértice já fechado cuja distância diminui volta ao heap
+ * (Moore-Dijkstra). As consultas ponto a ponto sem arcos negativos usam CaminhoBidirecional.
+ * Obs.: comportamento indefinido para grafos com ciclos negativos.
+ */
+void CaminhoMinimo::dijkstra(const GrafoCSR &csr, int origem, EspacoDijkstra &espaco)
+{
+    espaco.prepara(csr.ordem());
+    HeapIndexado &heap = espaco.heap;
+    espaco.geracoes[origem] = espaco.geracaoAtual;
+    espaco.distancias[origem] = 0;
+    espaco.predecessores[origem] = -1;
+    heap.insereOuDiminui(origem, 0);
+    while (!heap.vazio())
+    {
+        int distanciaAtual = heap.chaveMinima();
+        int atual = heap.removeMinimo();
+        for (int k = csr.inicio[atual]; k < csr.inicio[atual + 1]; k++)
+        {
+            int vizinho = csr.destinos[k];
+            int distancia = distanciaAtual + csr.pesos[k];
+            if (distancia < espaco.distancia(vizinho))
+            {
+                espaco.geracoes[vizinho] = espaco.geracaoAtual;
+                espaco.distancias[vizinho] = distancia;
+                espaco.predecessores[vizinho] = atual;
+                heap.insereOuDiminui(vizinho, distancia);
+            }
+        }
+    }
+}
+
+/**
+ * Calcula os potenciais da reponderação de Johnson: as distâncias mínimas a partir de um vértice fictício ligado a
+ * todos os vértices por arcos de peso 0, obtidas com Bellman-Ford. Com eles, peso(u, v) + potenciais[u] - potenciais[v]
+ * é não-negativo para todo arco e os caminhos mínimos são preservados.
+ * Retorna false caso o grafo possua ciclo negativo (os potenciais não convergem).
+ */
+bool CaminhoMinimo::potenciaisJohnson(const GrafoCSR &csr, std::vector<int> &potenciais)
+{
+    int ordem = csr.ordem();
+    potenciais.assign(ordem, 0);
+    for (int rodada = 0; rodada < ordem; rodada++)
+    {
+        bool alterou = false;
+        for (int u = 0; u < ordem; u++)
+        {
+            for (int k = csr.inicio[u]; k < csr.inicio[u + 1]; k++)
+            {
+                int distancia = potenciais[u] + csr.pesos[k];
+                if (distancia < potenciais[csr.destinos[k]])
+                {
+                    potenciais[csr.destinos[k]] = distancia;
+                    alterou = true;
+                }
+            }
+        }
+        if (!alterou)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,42 @@
+#ifndef CAMINHO_MINIMO_HPP
+#define CAMINHO_MINIMO_HPP
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "GrafoCSR.hpp"
+#include "HeapIndexado.hpp"
+
+/**
+ * Algoritmos de caminho mínimo de origem única sobre a fotografia CSR do grafo.
+ */
+namespace CaminhoMinimo
+{
+    const int INFINITO = std::numeric_limits<int>::max();
+
+    /**
+     * Vetores de trabalho do Dijkstra, reaproveitados entre consultas. Cada consulta recebe uma nova
+     * geração e uma posição só é considerada preenchida se foi marcada na geração corrente, de forma que
+     * nenhuma consulta precisa reinicializar (nem realocar) os vetores inteiros.
+     */
+    struct EspacoDijkstra
+    {
+        std::vector<int> distancias;
+        std::vector<int> predecessores;
+        std::vector<unsigned> geracoes;
+        unsigned geracaoAtual = 0;
+        HeapIndexado heap;
+
+        void prepara(int ordem);
+        bool alcancado(int v) const { return geracoes[v] == geracaoAtual; }
+        int distancia(int v) const { return alcancado(v) ? distancias[v] : INFINITO; }
+        int predecessor(int v) const { return alcancado(v) ? predecessores[v] : -1; }
+    };
+
+    EspacoDijkstra &getEspacoThread();
+    bool possuiPesosNegativos(const GrafoCSR &csr);
+    void dijkstra(const GrafoCSR &csr, int origem, EspacoDijkstra &espaco);
+    bool potenciaisJohnson(const GrafoCSR &csr, std::vector<int> &potenciais);
+}
+
+#endif
@@ -0,0 +1,151 @@
+#include "ComponentesConexas.hpp"
+#include "Trabalhadores.hpp"
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+
+ComponentesConexas::Floresta::Floresta(int ordem) : pais(new std::atomic<int>[ordem])
+{
+    for (int v = 0; v < ordem; v++)
+    {
+        pais[v].store(v, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * Raiz da árvore de v, com divisão pela metade do caminho (cada vértice visitado passa a apontar para o avô).
+ * As escritas concorrentes da compressão são inofensivas: só trocam um ancestral por outro ancestral.
+ */
+int ComponentesConexas::Floresta::raiz(int v)
+{
+    int pai = pais[v].load(std::memory_order_relaxed);
+    while (pai != v)
+    {
+        int avo = pais[pai].load(std::memory_order_relaxed);
+        if (avo != pai)
+        {
+            pais[v].store(avo, std::memory_order_relaxed);
+        }
+        v = pai;
+        pai = avo;
+    }
+    return v;
+}
+
+/**
+ * Une as árvores de u e v pendurando a raiz maior na menor. O compare-and-swap só tem sucesso se a raiz maior
+ * ainda for raiz; caso contrário outra thread a ligou antes e a operação é refeita com as novas raízes.
+ */
+void ComponentesConexas::Floresta::une(int u, int v)
+{
+    while (true)
+    {
+        int raizU = raiz(u);
+        int raizV = raiz(v);
+        if (raizU == raizV)
+        {
+            return;
+        }
+        int maior = std::max(raizU, raizV);
+        int menor = std::min(raizU, raizV);
+        if (pais[maior].compare_exchange_weak(maior, menor, std::memory_order_acq_rel))
+        {
+            return;
+        }
+        u = raizU;
+        v = raizV;
+    }
+}
+
+/**
+ * Executa 'funcao' para cada vértice 0..ordem-1, distribuindo lotes de TAMANHO_LOTE vértices entre as threads.
+ */
+void ComponentesConexas::paraCadaVertice(int ordem, int threads, const std::function<void(int)> &funcao)
+{
+    int lotes = (ordem + TAMANHO_LOTE - 1) / TAMANHO_LOTE;
+    std::atomic<int> proximoLote(0);
+    auto processaLotes = [&]()
+    {
+        for (int lote = proximoLote++; lote < lotes; lote = proximoLote++)
+        {
+            int fim = std::min(ordem, (lote + 1) * TAMANHO_LOTE);
+            for (int v = lote * TAMANHO_LOTE; v < fim; v++)
+            {
+                funcao(v);
+            }
+        }
+    };
+    Trabalhadores::executa(std::max(1, std::min(threads, lotes)), processaLotes);
+}
+
+/**
+ * Preenche 'rotulos' com a componente de cada vértice, numeradas de 0 em diante na ordem do menor vértice de
+ * cada uma, e retorna o número de componentes. 'threads' igual a 0 utiliza o número de núcleos da máquina.
+ */
+int ComponentesConexas::rotula(const GrafoCSR &csr, int threads, std::vector<int> &rotulos)
+{
+    int ordem = csr.ordem();
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    Floresta floresta(ordem);
+    for (int rodada = 0; rodada < RODADAS_VIZINHOS; rodada++)
+    {
+        paraCadaVertice(ordem, threads, [&](int v)
+        {
+            if (rodada < csr.grau(v))
+            {
+                floresta.une(v, csr.destinos[csr.inicio[v] + rodada]);
+            }
+        });
+    }
+    // a maior componente parcial, estimada por amostragem, dispensa o restante das adjacências de seus vértices;
+    // em grafos direcionados cada arco só aparece na adjacência da origem e nenhum vértice pode ser dispensado
+    int maiorComponente = -1;
+    if (!csr.direcionado && ordem > 0)
+    {
+        std::unordered_map<int, int> frequencias;
+        int maiorFrequencia = 0;
+        for (int amostra = 0; amostra < AMOSTRAS; amostra++)
+        {
+            int raiz = floresta.raiz((int)((long long)amostra * ordem / AMOSTRAS));
+            if (++frequencias[raiz] > maiorFrequencia)
+            {
+                maiorFrequencia = frequencias[raiz];
+                maiorComponente = raiz;
+            }
+        }
+    }
+    paraCadaVertice(ordem, threads, [&](int v)
+    {
+        if (maiorComponente != -1 && floresta.raiz(v) == maiorComponente)
+        {
+            return;
+        }
+        for (int k = csr.inicio[v] + RODADAS_VIZINHOS; k < csr.inicio[v + 1]; k++)
+        {
+            floresta.une(v, csr.destinos[k]);
+        }
+    });
+    rotulos.resize(ordem);
+    paraCadaVertice(ordem, threads, [&](int v)
+    {
+        rotulos[v] = floresta.raiz(v);
+    });
+    int componentes = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        rotulos[v] = rotulos[v] == v ? componentes++ : rotulos[rotulos[v]];
+    }
+    return componentes;
+}
+
+/**
+ * Retorna true se o grafo possui uma única componente (fracamente) conexa. O grafo sem vértices é considerado conexo.
+ */
+bool ComponentesConexas::conexo(const GrafoCSR &csr, int threads)
+{
+    std::vector<int> rotulos;
+    return rotula(csr, threads, rotulos) <= 1;
+}
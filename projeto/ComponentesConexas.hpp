@@ -0,0 +1,40 @@
+#ifndef COMPONENTES_CONEXAS_HPP
+#define COMPONENTES_CONEXAS_HPP
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <functional>
+#include "GrafoCSR.hpp"
+
+/**
+ * Componentes conexas (fracamente conexas, em grafos direcionados) por union-find paralelo sem travas, no estilo
+ * Afforest: cada thread une as extremidades dos arcos com compare-and-swap, sempre pendurando a raiz de maior
+ * índice na de menor, de modo que a raiz final de cada componente é seu menor vértice. As primeiras rodadas
+ * unem apenas alguns vizinhos de cada vértice; uma amostra identifica então a maior componente já formada, cujos
+ * vértices não precisam percorrer o restante de suas adjacências em grafos não-direcionados.
+ */
+namespace ComponentesConexas
+{
+    const int RODADAS_VIZINHOS = 2; // vizinhos de cada vértice unidos antes da amostragem
+    const int AMOSTRAS = 1024;
+    const int TAMANHO_LOTE = 4096;  // vértices entregues a uma thread por vez
+
+    /**
+     * Floresta de union-find com pais atômicos.
+     */
+    struct Floresta
+    {
+        std::unique_ptr<std::atomic<int>[]> pais;
+
+        Floresta(int ordem);
+        int raiz(int v);
+        void une(int u, int v);
+    };
+
+    int rotula(const GrafoCSR &csr, int threads, std::vector<int> &rotulos);
+    bool conexo(const GrafoCSR &csr, int threads);
+    void paraCadaVertice(int ordem, int threads, const std::function<void(int)> &funcao);
+}
+
+#endif
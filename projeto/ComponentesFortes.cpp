@@ -0,0 +1,135 @@
+#include "ComponentesFortes.hpp"
+#include <algorithm>
+
+/**
+ * Preenche 'rotulos' com a componente fortemente conexa de cada vértice e retorna o número de componentes.
+ * O Tarjan fecha primeiro as componentes sem saída; a numeração é invertida ao final para que fique em
+ * ordem topológica.
+ */
+int ComponentesFortes::rotula(const GrafoCSR &csr, std::vector<int> &rotulos)
+{
+    int ordem = csr.ordem();
+    rotulos.assign(ordem, -1);
+    std::vector<int> tempoEntrada(ordem, -1);
+    std::vector<int> minimo(ordem);
+    std::vector<Quadro> pilha;
+    std::vector<int> pilhaVertices; // vértices visitados cuja componente ainda não foi fechada
+    int cronometro = 0;
+    int componentes = 0;
+    for (int raiz = 0; raiz < ordem; raiz++)
+    {
+        if (tempoEntrada[raiz] != -1)
+        {
+            continue;
+        }
+        tempoEntrada[raiz] = minimo[raiz] = cronometro++;
+        pilhaVertices.push_back(raiz);
+        pilha.push_back({raiz, csr.inicio[raiz]});
+        while (!pilha.empty())
+        {
+            Quadro &quadro = pilha.back();
+            int v = quadro.vertice;
+            if (quadro.proximoArco < csr.inicio[v + 1])
+            {
+                int u = csr.destinos[quadro.proximoArco++];
+                if (tempoEntrada[u] == -1)
+                {
+                    tempoEntrada[u] = minimo[u] = cronometro++;
+                    pilhaVertices.push_back(u);
+                    pilha.push_back({u, csr.inicio[u]}); // invalida 'quadro'
+                }
+                else if (rotulos[u] == -1)
+                {
+                    minimo[v] = std::min(minimo[v], tempoEntrada[u]); // u ainda está na pilha de vértices
+                }
+                continue;
+            }
+            pilha.pop_back();
+            if (minimo[v] == tempoEntrada[v])
+            {
+                int desempilhado;
+                do
+                {
+                    desempilhado = pilhaVertices.back();
+                    pilhaVertices.pop_back();
+                    rotulos[desempilhado] = componentes;
+                } while (desempilhado != v);
+                componentes++;
+            }
+            if (!pilha.empty())
+            {
+                int pai = pilha.back().vertice;
+                minimo[pai] = std::min(minimo[pai], minimo[v]);
+            }
+        }
+    }
+    for (int &rotulo : rotulos)
+    {
+        rotulo = componentes - 1 - rotulo;
+    }
+    return componentes;
+}
+
+/**
+ * Calcula as componentes fortemente conexas do grafo e monta a condensação. Os arcos do DAG são únicos e, em
+ * cada componente, aparecem na ordem em que são encontrados ao percorrer seus membros em ordem crescente.
+ */
+void ComponentesFortes::condensa(const GrafoCSR &csr, Condensacao &condensacao)
+{
+    int ordem = csr.ordem();
+    int numero = rotula(csr, condensacao.componentes);
+    const std::vector<int> &componentes = condensacao.componentes;
+    condensacao.inicioMembros.assign(numero + 1, 0);
+    for (int v = 0; v < ordem; v++)
+    {
+        condensacao.inicioMembros[componentes[v] + 1]++;
+    }
+    for (int c = 0; c < numero; c++)
+    {
+        condensacao.inicioMembros[c + 1] += condensacao.inicioMembros[c];
+    }
+    condensacao.membros.resize(ordem);
+    std::vector<int> posicoes(condensacao.inicioMembros.begin(), condensacao.inicioMembros.end() - 1);
+    for (int v = 0; v < ordem; v++)
+    {
+        condensacao.membros[posicoes[componentes[v]]++] = v;
+    }
+    GrafoCSR &dag = condensacao.dag;
+    dag = GrafoCSR();
+    dag.direcionado = true;
+    dag.arestasPonderadas = false;
+    dag.verticesPonderados = true;
+    dag.ids.resize(numero);
+    dag.pesosVertices.resize(numero);
+    dag.inicio.assign(numero + 1, 0);
+    dag.indices.reserve(numero);
+    condensacao.ciclicas.assign(numero, 0);
+    std::vector<int> marcas(numero, -1); // última componente de origem que já possui arco para cada componente
+    for (int c = 0; c < numero; c++)
+    {
+        dag.ids[c] = c;
+        dag.indices[c] = c;
+        dag.pesosVertices[c] = condensacao.inicioMembros[c + 1] - condensacao.inicioMembros[c];
+        condensacao.ciclicas[c] = dag.pesosVertices[c] > 1;
+        for (int i = condensacao.inicioMembros[c]; i < condensacao.inicioMembros[c + 1]; i++)
+        {
+            int v = condensacao.membros[i];
+            for (int k = csr.inicio[v]; k < csr.inicio[v + 1]; k++)
+            {
+                int destino = componentes[csr.destinos[k]];
+                if (destino == c)
+                {
+                    condensacao.ciclicas[c] = 1; // arco interno: laço ou ciclo da componente
+                }
+                else if (marcas[destino] != c)
+                {
+                    marcas[destino] = c;
+                    dag.origens.push_back(c);
+                    dag.destinos.push_back(destino);
+                    dag.pesos.push_back(0);
+                }
+            }
+        }
+        dag.inicio[c + 1] = dag.destinos.size();
+    }
+}
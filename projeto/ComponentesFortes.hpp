@@ -0,0 +1,40 @@
+#ifndef COMPONENTES_FORTES_HPP
+#define COMPONENTES_FORTES_HPP
+
+#include <vector>
+#include "GrafoCSR.hpp"
+
+/**
+ * Componentes fortemente conexas por Tarjan com pilha explícita, em O(V + E), e o grafo condensado: um DAG em
+ * formato CSR com um vértice por componente e um arco entre duas componentes sempre que algum arco do grafo
+ * original as liga. Como todos os vértices de uma componente alcançam os mesmos vértices, fechos transitivos e
+ * consultas de alcançabilidade podem ser respondidos sobre o DAG, em geral muito menor.
+ */
+namespace ComponentesFortes
+{
+    /**
+     * As componentes são numeradas em ordem topológica: todo arco do DAG vai de uma componente para outra de
+     * número maior, de modo que percorrer os números em ordem decrescente é percorrer a ordem topológica reversa.
+     */
+    struct Condensacao
+    {
+        std::vector<int> componentes;   // componente de cada vértice do grafo original
+        std::vector<int> inicioMembros; // vértices da componente c em [inicioMembros[c], inicioMembros[c + 1]) de membros
+        std::vector<int> membros;
+        std::vector<char> ciclicas;     // 1 se a componente contém um ciclo (mais de um vértice ou laço)
+        GrafoCSR dag;                   // ids 0..numero-1 e peso de cada vértice igual ao tamanho da componente
+
+        int numero() const { return inicioMembros.size() - 1; }
+    };
+
+    struct Quadro
+    {
+        int vertice;
+        int proximoArco;
+    };
+
+    int rotula(const GrafoCSR &csr, std::vector<int> &rotulos);
+    void condensa(const GrafoCSR &csr, Condensacao &condensacao);
+}
+
+#endif
@@ -0,0 +1,236 @@
+#include "DeltaStepping.hpp"
+#include <algorithm>
+#include <thread>
+
+/**
+ * Indica se o delta-stepping deve substituir o Dijkstra sequencial: há mais de uma thread disponível e o grafo
+ * é grande o bastante. Não verifica a existência de arcos negativos.
+ */
+bool DeltaStepping::compensa(const GrafoCSR &csr, int threads)
+{
+    if (threads <= 0)
+    {
+        threads = std::thread::hardware_concurrency();
+    }
+    return threads > 1 && csr.numeroArcos() >= LIMITE_ARCOS_PARALELO;
+}
+
+/**
+ * Largura de balde automática: o maior peso dividido pelo grau médio, de modo que, em média, cada vértice tenha
+ * cerca de um arco leve por balde percorrido (sugestão de Meyer e Sanders para pesos aleatórios).
+ */
+int DeltaStepping::calculaDelta(const GrafoCSR &csr)
+{
+    int maiorPeso = 1;
+    for (int peso : csr.pesos)
+    {
+        maiorPeso = std::max(maiorPeso, peso);
+    }
+    long grauMedio = std::max(1L, (long)csr.numeroArcos() / std::max(1, csr.ordem()));
+    return std::max(1L, maiorPeso / grauMedio);
+}
+
+/**
+ * Calcula as distâncias a partir do índice denso 'origem' e as grava em 'espaco', junto dos predecessores de uma
+ * árvore de caminhos mínimos. As distâncias são as mesmas de CaminhoMinimo::dijkstra; havendo empates, o predecessor
+ * escolhido pode diferir, pois prevalece o pedido de relaxação que chega primeiro ao lote.
+ * - destino: se diferente de -1, a execução termina assim que todos os baldes anteriores à distância do destino
+ *   forem processados;
+ * - delta: largura dos baldes (0 utiliza calculaDelta). É aumentada, se necessário, para que o maior peso
+ *   caiba em MAXIMO_BALDES baldes;
+ * - threads: número de threads (0 utiliza o número de núcleos da máquina).
+ * Obs.: o grafo não pode possuir arcos de peso negativo.
+ */
+void DeltaStepping::executa(const GrafoCSR &csr, int origem, int destino, int delta, int threads, CaminhoMinimo::EspacoDijkstra &espaco)
+{
+    int ordem = csr.ordem();
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::max(1, std::min(threads, ordem));
+    int maiorPeso = 0;
+    for (int peso : csr.pesos)
+    {
+        maiorPeso = std::max(maiorPeso, peso);
+    }
+    if (delta <= 0)
+    {
+        delta = calculaDelta(csr);
+    }
+    delta = std::max(delta, maiorPeso / (MAXIMO_BALDES - 2) + 1);
+    espaco.prepara(ordem);
+    std::fill(espaco.geracoes.begin(), espaco.geracoes.begin() + ordem, espaco.geracaoAtual);
+    std::fill(espaco.distancias.begin(), espaco.distancias.begin() + ordem, CaminhoMinimo::INFINITO);
+    std::fill(espaco.predecessores.begin(), espaco.predecessores.begin() + ordem, -1);
+    Execucao execucao;
+    execucao.csr = &csr;
+    execucao.origem = origem;
+    execucao.destino = destino;
+    execucao.delta = delta;
+    execucao.threads = threads;
+    // distâncias vivas ficam em [i * delta, i * delta + maiorPeso], o que cabe em maiorPeso / delta + 2 baldes circulares
+    execucao.baldes = maiorPeso / delta + 2;
+    execucao.destinos.resize(csr.numeroArcos());
+    execucao.pesos.resize(csr.numeroArcos());
+    execucao.inicioPesados.resize(ordem);
+    execucao.pedidos.assign(threads, std::vector<std::vector<Pedido>>(threads));
+    execucao.menoresBaldes.resize(threads);
+    execucao.continua.resize(threads);
+    execucao.distancias = espaco.distancias.data();
+    execucao.predecessores = espaco.predecessores.data();
+    Barreira barreira(threads);
+    std::vector<std::thread> trabalhadores;
+    for (int parte = 1; parte < threads; parte++)
+    {
+        trabalhadores.emplace_back(executaParte, std::ref(execucao), parte, std::ref(barreira));
+    }
+    executaParte(execucao, 0, barreira);
+    for (std::thread &trabalhador : trabalhadores)
+    {
+        trabalhador.join();
+    }
+}
+
+/**
+ * Trabalho da thread 'parte', dona dos vértices v com v % threads == parte.
+ */
+void DeltaStepping::executaParte(Execucao &execucao, int parte, Barreira &barreira)
+{
+    const GrafoCSR &csr = *execucao.csr;
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int ordem = csr.ordem();
+    int threads = execucao.threads;
+    int delta = execucao.delta;
+    int *distancias = execucao.distancias;
+    int *predecessores = execucao.predecessores;
+    // separa os arcos leves dos pesados dos vértices desta thread, mantendo a ordem relativa de cada grupo
+    for (int u = parte; u < ordem; u += threads)
+    {
+        int posicao = csr.inicio[u];
+        for (int pesados = 0; pesados < 2; pesados++)
+        {
+            if (pesados == 1)
+            {
+                execucao.inicioPesados[u] = posicao;
+            }
+            for (int k = csr.inicio[u]; k < csr.inicio[u + 1]; k++)
+            {
+                if ((csr.pesos[k] > delta) == (pesados == 1))
+                {
+                    execucao.destinos[posicao] = csr.destinos[k];
+                    execucao.pesos[posicao] = csr.pesos[k];
+                    posicao++;
+                }
+            }
+        }
+    }
+    std::vector<std::vector<int>> baldes(execucao.baldes);
+    // indexados por u / threads: distância com que cada vértice desta thread foi relaxado pela última vez e
+    // último balde em que ele entrou no conjunto de relaxação pelos arcos pesados
+    std::vector<int> ultimaRelaxacao(ordem / threads + 1, -1);
+    std::vector<int> marcaBalde(ordem / threads + 1, -1);
+    std::vector<int> relaxados;
+    std::vector<int> atuais;
+    std::vector<std::vector<Pedido>> &meusPedidos = execucao.pedidos[parte];
+    auto aplicaPedidos = [&]()
+    {
+        for (int origemPedidos = 0; origemPedidos < threads; origemPedidos++)
+        {
+            for (const Pedido &pedido : execucao.pedidos[origemPedidos][parte])
+            {
+                if (pedido.distancia < distancias[pedido.vertice])
+                {
+                    distancias[pedido.vertice] = pedido.distancia;
+                    predecessores[pedido.vertice] = pedido.predecessor;
+                    baldes[(pedido.distancia / delta) % execucao.baldes].push_back(pedido.vertice);
+                }
+            }
+        }
+    };
+    if (execucao.origem % threads == parte)
+    {
+        distancias[execucao.origem] = 0;
+        baldes[0].push_back(execucao.origem);
+    }
+    barreira.espera();
+    for (int balde = 0; ; balde++)
+    {
+        // menor balde não vazio entre todas as threads (entradas obsoletas contam como não vazias, o que é inofensivo)
+        int meuMenor = INFINITO;
+        for (int b = balde; b < balde + execucao.baldes; b++)
+        {
+            if (!baldes[b % execucao.baldes].empty())
+            {
+                meuMenor = b;
+                break;
+            }
+        }
+        execucao.menoresBaldes[parte] = meuMenor;
+        barreira.espera();
+        balde = *std::min_element(execucao.menoresBaldes.begin(), execucao.menoresBaldes.end());
+        bool destinoFechado = execucao.destino != -1 && balde != INFINITO && distancias[execucao.destino] < (long)balde * delta;
+        barreira.espera();
+        if (balde == INFINITO || destinoFechado)
+        {
+            break;
+        }
+        std::vector<int> &baldeAtual = baldes[balde % execucao.baldes];
+        relaxados.clear();
+        while (true)
+        {
+            atuais.clear();
+            atuais.swap(baldeAtual);
+            for (int u : atuais)
+            {
+                int distanciaU = distancias[u];
+                int local = u / threads;
+                if (distanciaU / delta != balde || ultimaRelaxacao[local] == distanciaU)
+                {
+                    continue; // entrada obsoleta ou vértice já relaxado com esta distância
+                }
+                ultimaRelaxacao[local] = distanciaU;
+                if (marcaBalde[local] != balde)
+                {
+                    marcaBalde[local] = balde;
+                    relaxados.push_back(u);
+                }
+                for (int k = csr.inicio[u]; k < execucao.inicioPesados[u]; k++)
+                {
+                    int v = execucao.destinos[k];
+                    meusPedidos[v % threads].push_back({v, distanciaU + execucao.pesos[k], u});
+                }
+            }
+            barreira.espera();
+            aplicaPedidos();
+            barreira.espera();
+            for (std::vector<Pedido> &pedidos : meusPedidos)
+            {
+                pedidos.clear();
+            }
+            execucao.continua[parte] = !baldeAtual.empty();
+            barreira.espera();
+            bool algumaContinua = std::find(execucao.continua.begin(), execucao.continua.end(), 1) != execucao.continua.end();
+            barreira.espera();
+            if (!algumaContinua)
+            {
+                break;
+            }
+        }
+        for (int u : relaxados)
+        {
+            for (int k = execucao.inicioPesados[u]; k < csr.inicio[u + 1]; k++)
+            {
+                int v = execucao.destinos[k];
+                meusPedidos[v % threads].push_back({v, distancias[u] + execucao.pesos[k], u});
+            }
+        }
+        barreira.espera();
+        aplicaPedidos();
+        barreira.espera();
+        for (std::vector<Pedido> &pedidos : meusPedidos)
+        {
+            pedidos.clear();
+        }
+    }
+}
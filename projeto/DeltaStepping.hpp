@@ -0,0 +1,56 @@
+#ifndef DELTA_STEPPING_HPP
+#define DELTA_STEPPING_HPP
+
+#include <vector>
+#include "GrafoCSR.hpp"
+#include "CaminhoMinimo.hpp"
+#include "Barreira.hpp"
+
+/**
+ * Caminhos mínimos de origem única por delta-stepping paralelo (Meyer e Sanders), para grafos sem arcos negativos.
+ * As distâncias provisórias são agrupadas em baldes de largura 'delta'; os vértices do menor balde não vazio são
+ * relaxados em conjunto pelos arcos leves (peso <= delta) até o balde esvaziar e, em seguida, uma única vez pelos
+ * arcos pesados. Cada vértice pertence a uma thread (v % threads), que é a única a alterar sua distância e a
+ * guardá-lo em seus baldes: as relaxações viram pedidos gravados em buffers separados por thread de destino
+ * e aplicados pela dona do vértice depois de uma barreira, sem operações atômicas.
+ */
+namespace DeltaStepping
+{
+    const int MAXIMO_BALDES = 1 << 16;          // limita os baldes vivos (e a memória) quando delta é muito menor que os pesos
+    const int LIMITE_ARCOS_PARALELO = 1 << 20;  // abaixo disso as barreiras custam mais que o Dijkstra sequencial
+
+    struct Pedido
+    {
+        int vertice;
+        int distancia;
+        int predecessor;
+    };
+
+    /**
+     * Estado compartilhado de uma execução.
+     */
+    struct Execucao
+    {
+        const GrafoCSR *csr;
+        int origem;
+        int destino;
+        int delta;
+        int threads;
+        int baldes;                                       // baldes circulares por thread
+        std::vector<int> destinos;                        // arcos de cada vértice reordenados: leves antes dos pesados
+        std::vector<int> pesos;
+        std::vector<int> inicioPesados;                   // posição do primeiro arco pesado de cada vértice
+        std::vector<std::vector<std::vector<Pedido>>> pedidos; // pedidos[origem do pedido][thread dona do vértice]
+        std::vector<int> menoresBaldes;                   // menor balde não vazio de cada thread
+        std::vector<char> continua;                       // se o balde corrente de cada thread ainda tem vértices
+        int *distancias;
+        int *predecessores;
+    };
+
+    bool compensa(const GrafoCSR &csr, int threads);
+    int calculaDelta(const GrafoCSR &csr);
+    void executa(const GrafoCSR &csr, int origem, int destino, int delta, int threads, CaminhoMinimo::EspacoDijkstra &espaco);
+    void executaParte(Execucao &execucao, int parte, Barreira &barreira);
+}
+
+#endif
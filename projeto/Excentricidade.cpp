@@ -0,0 +1,217 @@
+#include "Excentricidade.hpp"
+#include "CaminhoMinimo.hpp"
+#include "TodosPares.hpp"
+#include "BuscaLargura.hpp"
+#include <algorithm>
+
+/**
+ * Excentricidade do vértice 'origem' a partir de suas distâncias para todos os 'ordem' vértices do grafo.
+ * obs.: distância 0 indica selfloop e distância INFINITO indica que não há caminho entre os vértices.
+ */
+int Excentricidade::calcula(const int *distancias, int ordem, int origem)
+{
+    int excentricidade = SEM_EXCENTRICIDADE;
+    for (int j = 0; j < ordem; j++)
+    {
+        int distancia = distancias[j];
+        if (j != origem && distancia != 0 && distancia != CaminhoMinimo::INFINITO && distancia > excentricidade)
+        {
+            excentricidade = distancia;
+        }
+    }
+    return excentricidade;
+}
+
+/**
+ * Em grafos não-direcionados sem arcos negativos as distâncias (ou os números de arestas, em grafos sem ponderação)
+ * formam uma métrica e os limitantes podem ser utilizados; nos demais casos, todas as excentricidades são calculadas.
+ */
+Excentricidade::Extremos Excentricidade::calculaExtremos(const GrafoCSR &csr, int threads)
+{
+    if (csr.direcionado || (csr.arestasPonderadas && CaminhoMinimo::possuiPesosNegativos(csr)))
+    {
+        return calculaExtremosTodosPares(csr, threads);
+    }
+    return calculaExtremosLimitantes(csr, threads);
+}
+
+Excentricidade::Extremos Excentricidade::calculaExtremosTodosPares(const GrafoCSR &csr, int threads)
+{
+    int ordem = csr.ordem();
+    std::vector<int> excentricidades(ordem);
+    // cada linha de distâncias é reduzida à excentricidade da origem assim que é calculada
+    TodosPares::percorreLinhas(csr, threads, [&](int origem, const int *distancias)
+    {
+        excentricidades[origem] = calcula(distancias, ordem, origem);
+    });
+    return extremosDe(excentricidades, std::vector<bool>(ordem, true));
+}
+
+/**
+ * Calcula os extremos mantendo, para cada vértice v, limitantes inferior e superior de sua excentricidade
+ * (no estilo de Takes e Kosters). Cada busca a partir de uma origem s fornece a excentricidade exata de s e,
+ * para todo v da mesma componente, max(d(s, v), exc(s) - d(s, v)) <= exc(v) <= exc(s) + d(s, v).
+ * Um vértice deixa de ser candidato quando sua excentricidade é conhecida ou quando os limitantes provam que ela
+ * é maior que um limitante superior do raio e menor que um limitante inferior do diâmetro; assim, todos os
+ * vértices do centro e da periferia terminam com excentricidade exata. As origens são escolhidas alternadamente
+ * entre o candidato de maior limitante superior e o de menor limitante inferior.
+ * Se após LIMITE_BUSCAS buscas ainda houver candidatos, suas excentricidades são calculadas por buscas em paralelo.
+ */
+Excentricidade::Extremos Excentricidade::calculaExtremosLimitantes(const GrafoCSR &csr, int threads)
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    int ordem = csr.ordem();
+    std::vector<int> inferiores(ordem, 0);
+    std::vector<int> superiores(ordem, INFINITO);
+    std::vector<int> excentricidades(ordem, SEM_EXCENTRICIDADE);
+    std::vector<bool> conhecidas(ordem, false);
+    std::vector<int> linha(ordem);
+    std::vector<int> candidatos;
+    for (int v = 0; v < ordem; v++)
+    {
+        conhecidas[v] = csr.grau(v) == 0; // vértices isolados não possuem excentricidade
+    }
+    CaminhoMinimo::EspacoDijkstra &espaco = CaminhoMinimo::getEspacoThread();
+    BuscaLargura::EspacoBusca &espacoBusca = BuscaLargura::getEspacoThread();
+    for (int busca = 0; ; busca++)
+    {
+        int limiteRaio = INFINITO;    // limitante superior do raio
+        int limiteDiametro = 0;       // limitante inferior do diâmetro
+        for (int v = 0; v < ordem; v++)
+        {
+            if (conhecidas[v])
+            {
+                if (excentricidades[v] != SEM_EXCENTRICIDADE)
+                {
+                    limiteRaio = std::min(limiteRaio, excentricidades[v]);
+                    limiteDiametro = std::max(limiteDiametro, excentricidades[v]);
+                }
+            }
+            else
+            {
+                if (superiores[v] > 0)
+                {
+                    limiteRaio = std::min(limiteRaio, superiores[v]);
+                }
+                limiteDiametro = std::max(limiteDiametro, inferiores[v]);
+            }
+        }
+        candidatos.clear();
+        int maiorSuperior = -1;
+        int menorInferior = -1;
+        for (int v = 0; v < ordem; v++)
+        {
+            if (conhecidas[v] || (inferiores[v] > limiteRaio && superiores[v] < limiteDiametro))
+            {
+                continue;
+            }
+            candidatos.push_back(v);
+            if (maiorSuperior == -1 || superiores[v] > superiores[maiorSuperior])
+            {
+                maiorSuperior = v;
+            }
+            if (menorInferior == -1 || inferiores[v] < inferiores[menorInferior])
+            {
+                menorInferior = v;
+            }
+        }
+        if (candidatos.empty())
+        {
+            break;
+        }
+        if (busca == LIMITE_BUSCAS)
+        {
+            auto consumidor = [&](int origem, const int *distancias)
+            {
+                excentricidades[origem] = calcula(distancias, ordem, origem);
+            };
+            if (csr.arestasPonderadas)
+            {
+                TodosPares::percorreLinhasDijkstra(csr, nullptr, threads, consumidor, &candidatos);
+            }
+            else
+            {
+                TodosPares::percorreLinhasBuscaLargura(csr, threads, consumidor, &candidatos);
+            }
+            for (int v : candidatos)
+            {
+                conhecidas[v] = true;
+            }
+            break;
+        }
+        int origem = busca % 2 == 0 ? maiorSuperior : menorInferior;
+        if (csr.arestasPonderadas)
+        {
+            CaminhoMinimo::dijkstra(csr, origem, espaco);
+            for (int v = 0; v < ordem; v++)
+            {
+                linha[v] = espaco.distancia(v);
+            }
+        }
+        else
+        {
+            BuscaLargura::busca(csr, nullptr, origem, -1, espacoBusca);
+            linha.swap(espacoBusca.distancias);
+        }
+        excentricidades[origem] = calcula(linha.data(), ordem, origem);
+        conhecidas[origem] = true;
+        int alcance = std::max(excentricidades[origem], 0); // maior distância finita a partir da origem
+        for (int v = 0; v < ordem; v++)
+        {
+            int distancia = linha[v];
+            if (conhecidas[v] || distancia == INFINITO)
+            {
+                continue;
+            }
+            inferiores[v] = std::max(inferiores[v], std::max(distancia, alcance - distancia));
+            superiores[v] = std::min(superiores[v], alcance + distancia);
+            if (superiores[v] == 0) // todas as distâncias a partir de v são nulas
+            {
+                conhecidas[v] = true;
+            }
+            else if (inferiores[v] == superiores[v])
+            {
+                excentricidades[v] = superiores[v];
+                conhecidas[v] = true;
+            }
+        }
+    }
+    return extremosDe(excentricidades, conhecidas);
+}
+
+/**
+ * Extrai raio, diâmetro, centro e periferia das excentricidades conhecidas.
+ */
+Excentricidade::Extremos Excentricidade::extremosDe(const std::vector<int> &excentricidades, const std::vector<bool> &conhecidas)
+{
+    Extremos extremos;
+    extremos.raio = CaminhoMinimo::INFINITO;
+    extremos.diametro = SEM_EXCENTRICIDADE;
+    for (int v = 0; v < (int)excentricidades.size(); v++)
+    {
+        int e = excentricidades[v];
+        if (!conhecidas[v] || e == SEM_EXCENTRICIDADE)
+        {
+            continue;
+        }
+        if (e < extremos.raio)
+        {
+            extremos.raio = e;
+            extremos.centro.clear();
+        }
+        if (e == extremos.raio)
+        {
+            extremos.centro.push_back(v);
+        }
+        if (e > extremos.diametro)
+        {
+            extremos.diametro = e;
+            extremos.periferia.clear();
+        }
+        if (e == extremos.diametro)
+        {
+            extremos.periferia.push_back(v);
+        }
+    }
+    return extremos;
+}
@@ -0,0 +1,33 @@
+#ifndef EXCENTRICIDADE_HPP
+#define EXCENTRICIDADE_HPP
+
+#include <vector>
+#include <limits>
+#include "GrafoCSR.hpp"
+
+/**
+ * Cálculo exato do raio, do diâmetro, do centro e da periferia de um grafo.
+ * A excentricidade de um vértice é a maior distância dele até os vértices que ele alcança, desconsiderando
+ * distâncias nulas; vértices sem nenhuma distância positiva não possuem excentricidade (SEM_EXCENTRICIDADE).
+ */
+namespace Excentricidade
+{
+    const int SEM_EXCENTRICIDADE = std::numeric_limits<int>::min();
+    const int LIMITE_BUSCAS = 100; // buscas sequenciais antes de recorrer às buscas paralelas para os vértices restantes
+
+    struct Extremos
+    {
+        int raio;                   // INFINITO se nenhum vértice possuir excentricidade
+        int diametro;
+        std::vector<int> centro;    // índices densos dos vértices com excentricidade igual ao raio, em ordem crescente
+        std::vector<int> periferia; // índices densos dos vértices com excentricidade igual ao diâmetro, em ordem crescente
+    };
+
+    int calcula(const int *distancias, int ordem, int origem);
+    Extremos calculaExtremos(const GrafoCSR &csr, int threads);
+    Extremos calculaExtremosTodosPares(const GrafoCSR &csr, int threads);
+    Extremos calculaExtremosLimitantes(const GrafoCSR &csr, int threads);
+    Extremos extremosDe(const std::vector<int> &excentricidades, const std::vector<bool> &conhecidas);
+}
+
+#endif
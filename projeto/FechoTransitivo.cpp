@@ -0,0 +1,168 @@
+#include "FechoTransitivo.hpp"
+#include "CacheBinario.hpp"
+#include "ArquivoMapeado.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+const char ASSINATURA_FECHO[8] = {'F', 'E', 'C', 'H', 'O', 'T', 'R', 'N'};
+const int32_t VERSAO_FECHO = 2;
+
+/**
+ * Retorna true se existe caminho com ao menos um arco de u até v (índices densos do grafo original).
+ * Um vértice só pertence ao próprio fecho se estiver em algum ciclo.
+ */
+bool FechoTransitivo::MatrizAlcance::alcanca(int u, int v) const
+{
+    int componenteU = componentes[u];
+    int componenteV = componentes[v];
+    if (componenteU == componenteV)
+    {
+        return ciclicas[componenteU];
+    }
+    return alcancaComponente(componenteU, componenteV);
+}
+
+/**
+ * Número de pares (u, v) do grafo original com v no fecho transitivo direto de u.
+ */
+long long FechoTransitivo::MatrizAlcance::pares() const
+{
+    long long total = 0;
+    for (int c = 0; c < numero; c++)
+    {
+        long long alcancados = ciclicas[c] ? tamanhos[c] : 0;
+        const uint64_t *linha = bits.data() + (size_t)c * palavras;
+        for (int p = 0; p < palavras; p++)
+        {
+            for (uint64_t palavra = linha[p]; palavra != 0; palavra &= palavra - 1)
+            {
+                alcancados += tamanhos[p * 64 + __builtin_ctzll(palavra)];
+            }
+        }
+        total += alcancados * tamanhos[c];
+    }
+    return total;
+}
+
+/**
+ * destino |= origem, palavra a palavra. Com AVX2 são combinadas quatro palavras por instrução; sem ele o laço
+ * simples é vetorizado pelo compilador.
+ */
+void FechoTransitivo::ouLinha(uint64_t *__restrict destino, const uint64_t *__restrict origem, int palavras)
+{
+    int p = 0;
+#if defined(__AVX2__)
+    for (; p + 4 <= palavras; p += 4)
+    {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destino + p));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(origem + p));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(destino + p), _mm256_or_si256(a, b));
+    }
+#endif
+    for (; p < palavras; p++)
+    {
+        destino[p] |= origem[p];
+    }
+}
+
+/**
+ * Calcula a matriz de alcance das componentes. Como o DAG está em ordem topológica, as componentes são
+ * processadas do maior número para o menor e cada sucessor já tem sua linha pronta. Os sucessores são visitados
+ * em ordem crescente: um sucessor já marcado foi alcançado por outro e sua linha já está contida na atual.
+ * Cada linha só possui bits nas colunas maiores que a própria componente, então o OU começa na palavra do sucessor.
+ */
+void FechoTransitivo::calcula(const ComponentesFortes::Condensacao &condensacao, MatrizAlcance &matriz)
+{
+    const GrafoCSR &dag = condensacao.dag;
+    int numero = condensacao.numero();
+    matriz.numero = numero;
+    matriz.palavras = (numero + 63) / 64;
+    matriz.componentes = condensacao.componentes;
+    matriz.ciclicas = condensacao.ciclicas;
+    matriz.tamanhos = dag.pesosVertices;
+    matriz.bits.assign((size_t)numero * matriz.palavras, 0);
+    std::vector<int> sucessores;
+    for (int c = numero - 1; c >= 0; c--)
+    {
+        uint64_t *linha = matriz.bits.data() + (size_t)c * matriz.palavras;
+        sucessores.assign(dag.destinos.begin() + dag.inicio[c], dag.destinos.begin() + dag.inicio[c + 1]);
+        std::sort(sucessores.begin(), sucessores.end());
+        for (int sucessor : sucessores)
+        {
+            if (matriz.alcancaComponente(c, sucessor))
+            {
+                continue;
+            }
+            linha[sucessor / 64] |= 1ULL << (sucessor % 64);
+            int primeira = sucessor / 64;
+            ouLinha(linha + primeira, matriz.bits.data() + (size_t)sucessor * matriz.palavras + primeira, matriz.palavras - primeira);
+        }
+    }
+}
+
+/**
+ * Grava a matriz: cabeçalho fixo, componentes dos vértices e tamanhos das componentes (inteiros de 32 bits),
+ * marcas de componentes cíclicas (um byte cada) e as linhas de bits, na ordem de bytes da máquina.
+ * Retorna false caso a escrita falhe.
+ */
+bool FechoTransitivo::salva(const MatrizAlcance &matriz, const GrafoCSR &csr, const std::string &caminho)
+{
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo)
+    {
+        return false;
+    }
+    Cabecalho cabecalho;
+    memset(&cabecalho, 0, sizeof(Cabecalho));
+    CacheBinario::preencheIndice(cabecalho.indice, ASSINATURA_FECHO, VERSAO_FECHO, csr);
+    cabecalho.numero = matriz.numero;
+    cabecalho.palavras = matriz.palavras;
+    arquivo.write(reinterpret_cast<const char *>(&cabecalho), sizeof(Cabecalho));
+    CacheBinario::escreveVetor(arquivo, matriz.componentes);
+    CacheBinario::escreveVetor(arquivo, matriz.tamanhos);
+    arquivo.write(matriz.ciclicas.data(), matriz.ciclicas.size());
+    arquivo.write(reinterpret_cast<const char *>(matriz.bits.data()), matriz.bits.size() * sizeof(uint64_t));
+    return (bool)arquivo;
+}
+
+/**
+ * Carrega uma matriz gravada por salva; 'matriz' só é alterada se o arquivo for válido para 'csr'.
+ */
+bool FechoTransitivo::carrega(const std::string &caminho, const GrafoCSR &csr, MatrizAlcance &matriz)
+{
+    ArquivoMapeado arquivo(caminho);
+    Cabecalho cabecalho;
+    const char *cursor = CacheBinario::abreIndice(arquivo, ASSINATURA_FECHO, VERSAO_FECHO, csr, &cabecalho, sizeof(Cabecalho));
+    if (cursor == nullptr || cabecalho.numero < 0 || cabecalho.palavras != (cabecalho.numero + 63) / 64)
+    {
+        return false;
+    }
+    size_t linhas = (size_t)cabecalho.numero * cabecalho.palavras;
+    size_t esperado = sizeof(Cabecalho) + sizeof(int32_t) * ((size_t)csr.ordem() + cabecalho.numero) + cabecalho.numero + sizeof(uint64_t) * linhas;
+    if (arquivo.tamanho() != esperado)
+    {
+        return false;
+    }
+    MatrizAlcance lida;
+    lida.numero = cabecalho.numero;
+    lida.palavras = cabecalho.palavras;
+    cursor = CacheBinario::leVetor(cursor, lida.componentes, csr.ordem());
+    cursor = CacheBinario::leVetor(cursor, lida.tamanhos, cabecalho.numero);
+    lida.ciclicas.assign(cursor, cursor + cabecalho.numero);
+    cursor += cabecalho.numero;
+    lida.bits.resize(linhas);
+    memcpy(lida.bits.data(), cursor, linhas * sizeof(uint64_t));
+    for (int componente : lida.componentes)
+    {
+        if (componente < 0 || componente >= lida.numero)
+        {
+            return false;
+        }
+    }
+    matriz = std::move(lida);
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef FECHO_TRANSITIVO_HPP
+#define FECHO_TRANSITIVO_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "GrafoCSR.hpp"
+#include "ComponentesFortes.hpp"
+#include "CacheBinario.hpp"
+
+/**
+ * Fecho transitivo de todos os vértices, calculado sobre o grafo condensado: cada componente fortemente conexa
+ * tem uma linha de bits (palavras de 64 bits) com as componentes que ela alcança, obtida em ordem topológica
+ * reversa pelo OU das linhas de seus sucessores. A consulta "v pertence ao fecho direto de u" é O(1).
+ */
+namespace FechoTransitivo
+{
+    struct MatrizAlcance
+    {
+        int numero = 0;                 // componentes (linhas e colunas da matriz)
+        int palavras = 0;               // palavras de 64 bits por linha
+        std::vector<int> componentes;   // componente de cada vértice do grafo original
+        std::vector<char> ciclicas;     // componentes que alcançam a si mesmas
+        std::vector<int> tamanhos;      // vértices de cada componente
+        std::vector<uint64_t> bits;     // linha c em [c * palavras, (c + 1) * palavras)
+
+        bool alcancaComponente(int origem, int destino) const
+        {
+            return (bits[(size_t)origem * palavras + destino / 64] >> (destino % 64)) & 1;
+        }
+        bool alcanca(int u, int v) const;
+        long long pares() const;
+    };
+
+    struct Cabecalho
+    {
+        CacheBinario::CabecalhoIndice indice;
+        int32_t numero;
+        int32_t palavras;
+    };
+
+    void calcula(const ComponentesFortes::Condensacao &condensacao, MatrizAlcance &matriz);
+    void ouLinha(uint64_t *__restrict destino, const uint64_t *__restrict origem, int palavras);
+    bool salva(const MatrizAlcance &matriz, const GrafoCSR &csr, const std::string &caminho);
+    bool carrega(const std::string &caminho, const GrafoCSR &csr, MatrizAlcance &matriz);
+}
+
+#endif
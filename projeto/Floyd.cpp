@@ -0,0 +1,251 @@
+#include "Floyd.hpp"
+#include <algorithm>
+#include <vector>
+#include <thread>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+Floyd::MatrizQuadrada::MatrizQuadrada()
+{
+    n = 0;
+    colunas = 0;
+    dados = nullptr;
+}
+
+Floyd::MatrizQuadrada::~MatrizQuadrada()
+{
+    std::free(dados);
+}
+
+/**
+ * Descarta o conteúdo atual e prepara a matriz para 'ordem' vértices, com todas as posições
+ * (inclusive as de preenchimento) iguais a 'valorInicial'.
+ */
+void Floyd::MatrizQuadrada::redimensiona(int ordem, int valorInicial)
+{
+    std::free(dados);
+    n = ordem;
+    colunas = (ordem + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO * TAMANHO_BLOCO;
+    size_t posicoes = (size_t)colunas * colunas;
+    dados = posicoes == 0 ? nullptr : static_cast<int *>(std::aligned_alloc(64, posicoes * sizeof(int)));
+    if (posicoes != 0 && dados == nullptr)
+    {
+        n = 0;
+        colunas = 0;
+        throw std::bad_alloc();
+    }
+    std::fill(dados, dados + posicoes, valorInicial);
+}
+
+void Floyd::inicializaDistancias(const GrafoCSR &csr, MatrizQuadrada &distancias)
+{
+    int ordem = csr.ordem();
+    distancias.redimensiona(ordem, INFINITO);
+    for (int i = 0; i < ordem; i++)
+    {
+        int *linha = distancias.linha(i);
+        linha[i] = 0;
+        for (int k = csr.inicio[i]; k < csr.inicio[i + 1]; k++)
+        {
+            linha[csr.destinos[k]] = csr.pesos[k]; // custo é o peso da aresta
+        }
+    }
+}
+
+void Floyd::inicializaProximos(const GrafoCSR &csr, MatrizQuadrada &proximos)
+{
+    int ordem = csr.ordem();
+    proximos.redimensiona(ordem, -1);
+    for (int i = 0; i < ordem; i++)
+    {
+        int *linha = proximos.linha(i);
+        linha[i] = i;
+        for (int k = csr.inicio[i]; k < csr.inicio[i + 1]; k++)
+        {
+            linha[csr.destinos[k]] = csr.destinos[k]; // o próximo é o vértice de destino da aresta
+        }
+    }
+}
+
+/**
+ * Executa o Floyd-Warshall em três fases para cada bloco de pivôs K: primeiro o bloco diagonal (K, K),
+ * depois os blocos da linha e da coluna de K, que dependem apenas dele, e por fim os demais blocos,
+ * que dependem apenas dos blocos da linha e da coluna. Cada bloco de TAMANHO_BLOCO x TAMANHO_BLOCO
+ * inteiros permanece na cache enquanto é relaxado por todos os pivôs de K.
+ * Os blocos de uma mesma fase são independentes entre si e são divididos entre 'threads' threads
+ * (0 utiliza o número de núcleos da máquina), criadas uma única vez e sincronizadas por uma barreira ao fim de cada fase.
+ * Se 'proximos' for diferente de nullptr, a matriz de próximos vértices é atualizada junto com as distâncias.
+ */
+void Floyd::executa(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int threads)
+{
+    int blocos = distancias.largura() / TAMANHO_BLOCO;
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = std::max(1, std::min(threads, (blocos - 1) * (blocos - 1))); // número de blocos da terceira fase
+    Barreira barreira(threads);
+    std::vector<std::thread> trabalhadores;
+    for (int parte = 1; parte < threads; parte++)
+    {
+        trabalhadores.emplace_back(executaParte, std::ref(distancias), proximos, parte, threads, std::ref(barreira));
+    }
+    executaParte(distancias, proximos, 0, threads, barreira);
+    for (std::thread &trabalhador : trabalhadores)
+    {
+        trabalhador.join();
+    }
+}
+
+/**
+ * Trabalho da thread de número 'parte' (entre 0 e threads - 1): em cada fase, ela relaxa os blocos cuja posição
+ * na lista de blocos da fase é congruente a 'parte' módulo 'threads'. O bloco diagonal fica com a parte 0.
+ */
+void Floyd::executaParte(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int parte, int threads, Barreira &barreira)
+{
+    int blocos = distancias.largura() / TAMANHO_BLOCO;
+    for (int k = 0; k < blocos; k++)
+    {
+        if (parte == 0)
+        {
+            relaxaBloco(distancias, proximos, k, k, k);
+        }
+        barreira.espera();
+        for (int b = parte; b < blocos; b += threads)
+        {
+            if (b != k)
+            {
+                relaxaBloco(distancias, proximos, k, b, k);
+                relaxaBloco(distancias, proximos, b, k, k);
+            }
+        }
+        barreira.espera();
+        for (int t = parte; t < blocos * blocos; t += threads)
+        {
+            int i = t / blocos;
+            int j = t % blocos;
+            if (i != k && j != k)
+            {
+                relaxaBloco(distancias, proximos, i, j, k);
+            }
+        }
+        barreira.espera();
+    }
+}
+
+/**
+ * Relaxa o bloco (blocoI, blocoJ) utilizando como intermediários os vértices do bloco de pivôs blocoK.
+ * Linhas cuja distância até o pivô é INFINITO não podem ser melhoradas e são ignoradas de uma só vez, assim
+ * como a linha do próprio pivô (sem ciclos negativos, distancias[k][k] >= 0 e ela nunca melhora); por isso
+ * linhaI e linhaK nunca se sobrepõem.
+ */
+void Floyd::relaxaBloco(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int blocoI, int blocoJ, int blocoK)
+{
+    int colunaInicial = blocoJ * TAMANHO_BLOCO;
+    for (int k = blocoK * TAMANHO_BLOCO; k < (blocoK + 1) * TAMANHO_BLOCO; k++)
+    {
+        const int *linhaK = distancias.linha(k) + colunaInicial;
+        for (int i = blocoI * TAMANHO_BLOCO; i < (blocoI + 1) * TAMANHO_BLOCO; i++)
+        {
+            int distanciaIK = distancias.linha(i)[k];
+            if (distanciaIK == INFINITO || i == k)
+            {
+                continue;
+            }
+            int *linhaI = distancias.linha(i) + colunaInicial;
+            if (proximos == nullptr)
+            {
+                relaxaLinha(linhaI, linhaK, distanciaIK);
+            }
+            else
+            {
+                int *proximosI = proximos->linha(i);
+                relaxaLinha(linhaI, linhaK, distanciaIK, proximosI + colunaInicial, proximosI[k]);
+            }
+        }
+    }
+}
+
+/**
+ * distanciaIK + distanciaKJ com saturação: INFINITO em distanciaKJ continua INFINITO e, se a soma estourar, o
+ * resultado é INFINITO (parcelas positivas) ou o menor inteiro (parcelas negativas) em vez de dar a volta.
+ * A soma é feita sem sinal para que o estouro não seja comportamento indefinido; ele ocorre quando o resultado
+ * tem sinal diferente do das duas parcelas.
+ */
+int Floyd::somaSaturada(int distanciaIK, int distanciaKJ)
+{
+    int soma = (int)((unsigned)distanciaIK + (unsigned)distanciaKJ);
+    if (((distanciaIK ^ soma) & (distanciaKJ ^ soma)) < 0)
+    {
+        soma = distanciaIK < 0 ? std::numeric_limits<int>::min() : INFINITO;
+    }
+    return distanciaKJ == INFINITO ? INFINITO : soma;
+}
+
+/**
+ * linhaI[j] = min(linhaI[j], distanciaIK + linhaK[j]), com a soma saturada de somaSaturada. Na versão AVX2 o
+ * estouro é detectado pelo bit de sinal de (a ^ soma) & (b ^ soma) e o valor saturado, que só depende do sinal de
+ * distanciaIK, é escolhido por blend.
+ * Cada chamada processa TAMANHO_BLOCO colunas, a partir de posições alinhadas em 32 bytes.
+ */
+void Floyd::relaxaLinha(int *__restrict linhaI, const int *__restrict linhaK, int distanciaIK)
+{
+#if defined(__AVX2__)
+    const __m256i pivo = _mm256_set1_epi32(distanciaIK);
+    const __m256i infinito = _mm256_set1_epi32(INFINITO);
+    const __m256i saturado = _mm256_set1_epi32(distanciaIK < 0 ? std::numeric_limits<int>::min() : INFINITO);
+    for (int j = 0; j < TAMANHO_BLOCO; j += 8)
+    {
+        __m256i distanciaKJ = _mm256_load_si256(reinterpret_cast<const __m256i *>(linhaK + j));
+        __m256i soma = _mm256_add_epi32(pivo, distanciaKJ);
+        __m256i estouro = _mm256_and_si256(_mm256_xor_si256(pivo, soma), _mm256_xor_si256(distanciaKJ, soma));
+        soma = _mm256_blendv_epi8(soma, saturado, _mm256_srai_epi32(estouro, 31));
+        soma = _mm256_blendv_epi8(soma, infinito, _mm256_cmpeq_epi32(distanciaKJ, infinito));
+        __m256i atual = _mm256_load_si256(reinterpret_cast<const __m256i *>(linhaI + j));
+        _mm256_store_si256(reinterpret_cast<__m256i *>(linhaI + j), _mm256_min_epi32(atual, soma));
+    }
+#else
+    for (int j = 0; j < TAMANHO_BLOCO; j++)
+    {
+        int soma = somaSaturada(distanciaIK, linhaK[j]);
+        linhaI[j] = std::min(linhaI[j], soma);
+    }
+#endif
+}
+
+/**
+ * Mesma relaxação da versão anterior, registrando proximoIK como próximo vértice de i a j sempre que a
+ * distância diminui estritamente.
+ */
+void Floyd::relaxaLinha(int *__restrict linhaI, const int *__restrict linhaK, int distanciaIK, int *__restrict proximosI, int proximoIK)
+{
+#if defined(__AVX2__)
+    const __m256i pivo = _mm256_set1_epi32(distanciaIK);
+    const __m256i infinito = _mm256_set1_epi32(INFINITO);
+    const __m256i saturado = _mm256_set1_epi32(distanciaIK < 0 ? std::numeric_limits<int>::min() : INFINITO);
+    const __m256i proximo = _mm256_set1_epi32(proximoIK);
+    for (int j = 0; j < TAMANHO_BLOCO; j += 8)
+    {
+        __m256i distanciaKJ = _mm256_load_si256(reinterpret_cast<const __m256i *>(linhaK + j));
+        __m256i soma = _mm256_add_epi32(pivo, distanciaKJ);
+        __m256i estouro = _mm256_and_si256(_mm256_xor_si256(pivo, soma), _mm256_xor_si256(distanciaKJ, soma));
+        soma = _mm256_blendv_epi8(soma, saturado, _mm256_srai_epi32(estouro, 31));
+        soma = _mm256_blendv_epi8(soma, infinito, _mm256_cmpeq_epi32(distanciaKJ, infinito));
+        __m256i atual = _mm256_load_si256(reinterpret_cast<const __m256i *>(linhaI + j));
+        __m256i melhora = _mm256_cmpgt_epi32(atual, soma);
+        _mm256_store_si256(reinterpret_cast<__m256i *>(linhaI + j), _mm256_min_epi32(atual, soma));
+        __m256i proximosAtuais = _mm256_load_si256(reinterpret_cast<const __m256i *>(proximosI + j));
+        _mm256_store_si256(reinterpret_cast<__m256i *>(proximosI + j), _mm256_blendv_epi8(proximosAtuais, proximo, melhora));
+    }
+#else
+    for (int j = 0; j < TAMANHO_BLOCO; j++)
+    {
+        int soma = somaSaturada(distanciaIK, linhaK[j]);
+        int atual = linhaI[j];
+        int melhora = -(int)(soma < atual); // máscara com todos os bits ligados quando a distância diminui
+        linhaI[j] = std::min(atual, soma);
+        proximosI[j] = (proximoIK & melhora) | (proximosI[j] & ~melhora);
+    }
+#endif
+}
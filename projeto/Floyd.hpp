@@ -0,0 +1,53 @@
+#ifndef FLOYD_HPP
+#define FLOYD_HPP
+
+#include <limits>
+#include <cstdlib>
+#include <new>
+#include "GrafoCSR.hpp"
+#include "Barreira.hpp"
+
+/**
+ * Floyd-Warshall em blocos sobre matrizes planas. As linhas das matrizes são alinhadas e completadas
+ * com INFINITO até um múltiplo de TAMANHO_BLOCO, de modo que o laço interno de relaxação não precisa
+ * tratar bordas e pode ser vetorizado (com instruções AVX2, quando o código é compilado com suporte a elas).
+ */
+namespace Floyd
+{
+    const int INFINITO = std::numeric_limits<int>::max();
+    const int TAMANHO_BLOCO = 64;
+
+    /**
+     * Matriz quadrada de inteiros armazenada por linhas em um único bloco de memória alinhado.
+     * Apenas as 'ordem' primeiras linhas e colunas têm significado; as demais, até 'largura', são preenchimento.
+     */
+    class MatrizQuadrada
+    {
+    public:
+        MatrizQuadrada();
+        ~MatrizQuadrada();
+        MatrizQuadrada(const MatrizQuadrada &) = delete;
+        MatrizQuadrada &operator=(const MatrizQuadrada &) = delete;
+        void redimensiona(int ordem, int valorInicial);
+        int ordem() const { return n; }
+        int largura() const { return colunas; }
+        int *linha(int i) { return dados + (size_t)i * colunas; }
+        const int *linha(int i) const { return dados + (size_t)i * colunas; }
+
+    private:
+        int n;
+        int colunas;
+        int *dados;
+    };
+
+    void inicializaDistancias(const GrafoCSR &csr, MatrizQuadrada &distancias);
+    void inicializaProximos(const GrafoCSR &csr, MatrizQuadrada &proximos);
+    void executa(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int threads = 0);
+    void executaParte(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int parte, int threads, Barreira &barreira);
+    void relaxaBloco(MatrizQuadrada &distancias, MatrizQuadrada *proximos, int blocoI, int blocoJ, int blocoK);
+    int somaSaturada(int distanciaIK, int distanciaKJ);
+    void relaxaLinha(int *__restrict linhaI, const int *__restrict linhaK, int distanciaIK);
+    void relaxaLinha(int *__restrict linhaI, const int *__restrict linhaK, int distanciaIK, int *__restrict proximosI, int proximoIK);
+}
+
+#endif
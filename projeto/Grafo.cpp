@@ -1,48 +1,45 @@
 #include "Grafo.hpp"
 
 const int INF = std::numeric_limits<int>::max();
-const int MIN = std::numeric_limits<int>::min();
 
-/**
- * Construtor que instancia um grafo de acordo com as arestas definidas em um arquivo .dat lido como argumento para a execução.
- */
-Grafo::Grafo(std::ifstream &arquivoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados)
+Grafo::Grafo(bool direcionado, bool arestasPonderadas, bool verticesPonderados)
 {
     this->direcionado = direcionado;
     this->arestasPonderadas = arestasPonderadas;
     this->verticesPonderados = verticesPonderados;
-    std::string linha;
-    getline(arquivoInstancia, linha);
-    while (getline(arquivoInstancia, linha))
-    {
-        std::stringstream stream(linha);
-        std::string item;
-        std::vector<int> itens;
-        while (getline(stream, item, ' '))
-        {
-            itens.push_back(std::stoi(item));
-        }
-        int idVerticeU = itens[0];
-        int idVerticeV = itens[1];
-        int pesoAresta = itens[2];
-        adicionaAresta(idVerticeU, idVerticeV, pesoAresta);
-    }
 }
 
-Grafo::Grafo(bool direcionado, bool arestasPonderadas, bool verticesPonderados)
+/**
+ * Construtor que reconstrói as listas de adjacências a partir de uma fotografia CSR (por exemplo, lida de um
+ * cache binário), preservando a ordem dos vértices e dos arcos. Os arcos são anexados diretamente, sem
+ * verificação de duplicidade, pois o CSR já descreve um grafo válido. A própria fotografia passa a ser o CSR
+ * memorizado da versão inicial, de modo que as consultas somente-leitura não congelam o grafo de novo.
+ */
+Grafo::Grafo(GrafoCSR csr)
 {
-    this->direcionado = direcionado;
-    this->arestasPonderadas = arestasPonderadas;
-    this->verticesPonderados = verticesPonderados;
+    this->direcionado = csr.direcionado;
+    this->arestasPonderadas = csr.arestasPonderadas;
+    this->verticesPonderados = csr.verticesPonderados;
+    vertices.reserve(csr.ordem());
+    indices.reserve(csr.ordem());
+    for (int i = 0; i < csr.ordem(); i++)
+    {
+        adicionaVertice(csr.ids[i], csr.pesosVertices[i]);
+    }
+    std::vector<Aresta *> caudas(csr.ordem(), nullptr);
+    for (int k = 0; k < csr.numeroArcos(); k++)
+    {
+        anexaAdjacencia(caudas, csr.origens[k], csr.destinos[k], csr.pesos[k]);
+    }
+    csrMemorizado = std::move(csr);
+    versaoCSR = versao;
 }
 
+/**
+ * Os vértices e arestas pertencem às arenas do grafo e são liberados em bloco quando elas são destruídas.
+ */
 Grafo::~Grafo()
 {
-    for (Vertice *vertice : vertices)
-    {
-        liberaMemoriaArestas(vertice->arestas);
-        delete vertice;
-    }
 }
 
 /**
@@ -62,6 +59,299 @@ void Grafo::print(std::ofstream &output)
     Printer::printGrafo(vertices, direcionado, arestasPonderadas, verticesPonderados, output);
 }
 
+/**
+ * Escreve no arquivo a árvore de um caminhamento em profundidade obtido por caminhamentoProfundidade,
+ * desde que o grafo não tenha sido modificado depois dele.
+ */
+void Grafo::printCaminhamento(const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &output)
+{
+    Printer::printArvoreCaminhamento(getCSR(), caminhamento, output);
+}
+
+/**
+ * Retorna uma fotografia imutável do grafo no formato CSR, na qual as adjacências de cada vértice ficam
+ * contíguas em memória. Os índices densos seguem a ordem do vetor de vértices e os arcos de cada vértice
+ * mantêm a ordem da lista de adjacências.
+ * Obs.: alterações posteriores no grafo não são refletidas na fotografia.
+ */
+GrafoCSR Grafo::congelar()
+{
+    GrafoCSR csr;
+    csr.direcionado = direcionado;
+    csr.arestasPonderadas = arestasPonderadas;
+    csr.verticesPonderados = verticesPonderados;
+    int ordem = vertices.size();
+    csr.ids.reserve(ordem);
+    csr.pesosVertices.reserve(ordem);
+    csr.inicio.reserve(ordem + 1);
+    csr.indices = indices;
+    int arcos = 0;
+    for (int i = 0; i < ordem; i++)
+    {
+        csr.ids.push_back(vertices[i]->id);
+        csr.pesosVertices.push_back(vertices[i]->peso);
+        csr.inicio.push_back(arcos);
+        for (Aresta *aresta = vertices[i]->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            arcos++;
+        }
+    }
+    csr.inicio.push_back(arcos);
+    csr.origens.reserve(arcos);
+    csr.destinos.reserve(arcos);
+    csr.pesos.reserve(arcos);
+    for (int i = 0; i < ordem; i++)
+    {
+        for (Aresta *aresta = vertices[i]->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            csr.origens.push_back(i);
+            csr.destinos.push_back(aresta->destino->indice);
+            csr.pesos.push_back(aresta->peso);
+        }
+    }
+    return csr;
+}
+
+/**
+ * Retorna a versão atual do grafo, incrementada a cada vértice ou aresta adicionado ou removido.
+ */
+long Grafo::getVersao() const
+{
+    return versao;
+}
+
+/**
+ * Retorna a fotografia CSR da versão atual do grafo, refazendo-a apenas se o grafo foi modificado
+ * desde a última chamada. A referência é válida até a próxima modificação do grafo.
+ */
+const GrafoCSR &Grafo::getCSR()
+{
+    if (versaoCSR != versao)
+    {
+        csrMemorizado = congelar();
+        versaoCSR = versao;
+    }
+    return csrMemorizado;
+}
+
+/**
+ * CSR com os arcos invertidos, memorizado como getCSR(). Em grafos não-direcionados é o próprio CSR.
+ */
+const GrafoCSR &Grafo::getCSRReverso()
+{
+    const GrafoCSR &csr = getCSR();
+    if (!direcionado)
+    {
+        return csr;
+    }
+    if (versaoCSRReverso != versao)
+    {
+        csrReversoMemorizado = csr.transposta();
+        versaoCSRReverso = versao;
+    }
+    return csrReversoMemorizado;
+}
+
+/**
+ * Indica se algum arco tem peso negativo, memorizado como getCSR() para que as consultas ponto a ponto não
+ * percorram todos os pesos a cada chamada.
+ */
+bool Grafo::possuiPesosNegativos()
+{
+    if (versaoPesosNegativos != versao)
+    {
+        pesosNegativos = CaminhoMinimo::possuiPesosNegativos(getCSR());
+        versaoPesosNegativos = versao;
+    }
+    return pesosNegativos;
+}
+
+/**
+ * Componentes fortemente conexas e grafo condensado, memorizados como getCSR().
+ */
+const ComponentesFortes::Condensacao &Grafo::getCondensacao()
+{
+    if (versaoCondensacao != versao)
+    {
+        ComponentesFortes::condensa(getCSR(), condensacaoMemorizada);
+        versaoCondensacao = versao;
+    }
+    return condensacaoMemorizada;
+}
+
+/**
+ * Matriz de alcance de todos os vértices, memorizada como getCSR().
+ */
+const FechoTransitivo::MatrizAlcance &Grafo::getFechoTransitivo()
+{
+    if (versaoFecho != versao)
+    {
+        FechoTransitivo::calcula(getCondensacao(), fechoMemorizado);
+        versaoFecho = versao;
+    }
+    return fechoMemorizado;
+}
+
+/**
+ * Índice de alcançabilidade, memorizado como getCSR(). As inserções de arestas entre vértices já existentes
+ * atualizam o índice em vez de invalidá-lo, exceto quando fundem componentes fortemente conexas.
+ */
+const IndiceAlcance::Indice &Grafo::getIndiceAlcance()
+{
+    if (versaoAlcance != versao)
+    {
+        IndiceAlcance::constroi(getCondensacao(), indiceAlcance);
+        versaoAlcance = versao;
+    }
+    return indiceAlcance;
+}
+
+/**
+ * Incorpora ao índice de alcançabilidade o arco (u, v) recém-inserido (posições no vetor de vértices) e, em grafos
+ * não-direcionados, também o arco (v, u). Retorna false se o índice precisar ser reconstruído.
+ */
+bool Grafo::insereArcoAlcance(int u, int v)
+{
+    if (!IndiceAlcance::insereArco(indiceAlcance, u, v))
+    {
+        return false;
+    }
+    return direcionado || IndiceAlcance::insereArco(indiceAlcance, v, u);
+}
+
+/**
+ * Imprime no console o consumo de memória dos nós do grafo: quantidade de alocações feitas nas arenas,
+ * pico de nós simultaneamente em uso, blocos reservados e total de bytes reservados.
+ */
+void Grafo::printMemoria()
+{
+    std::cout << "Memoria do grafo: " << arenaVertices.getAlocacoes() << " alocacoes de vertices (pico de "
+              << arenaVertices.getPicoEmUso() << " em uso, " << arenaVertices.getBlocos() << " blocos) e "
+              << arenaArestas.getAlocacoes() << " alocacoes de arestas (pico de " << arenaArestas.getPicoEmUso()
+              << " em uso, " << arenaArestas.getBlocos() << " blocos); "
+              << arenaVertices.getBytesReservados() + arenaArestas.getBytesReservados() << " bytes reservados\n";
+}
+
+/**
+ * Define o número de threads utilizadas pelos algoritmos paralelos do grafo (0 utiliza o número de núcleos da máquina).
+ */
+void Grafo::setThreads(int threads)
+{
+    this->threads = threads;
+}
+
+/**
+ * Define a largura dos baldes do delta-stepping utilizado nos caminhos mínimos de grafos grandes
+ * (0 escolhe a largura a partir dos pesos e do grau médio).
+ */
+void Grafo::setLarguraBalde(int larguraBalde)
+{
+    this->larguraBalde = larguraBalde;
+}
+
+/**
+ * Ativa ou desativa o índice de entradas: com ele ativo, cada vértice mantém a lista dos arcos que chegam a ele
+ * (e seu tamanho), atualizada a cada inserção ou remoção de arestas. O índice é montado numa única passada pelas
+ * adjacências ao ser ativado e descartado ao ser desativado; os arcos em si são compartilhados com as listas de saída.
+ */
+void Grafo::setIndiceEntradas(bool ativo)
+{
+    if (ativo == indiceEntradas)
+    {
+        return;
+    }
+    indiceEntradas = ativo;
+    for (Vertice *vertice : vertices)
+    {
+        vertice->entradas = nullptr;
+        vertice->grauEntrada = 0;
+    }
+    if (!ativo)
+    {
+        return;
+    }
+    for (Vertice *vertice : vertices)
+    {
+        for (Aresta *aresta = vertice->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            ligaEntrada(aresta);
+        }
+    }
+}
+
+/**
+ * Insere o arco no início da lista de entradas de seu destino, caso o índice de entradas esteja ativo.
+ */
+void Grafo::ligaEntrada(Aresta *aresta)
+{
+    if (!indiceEntradas)
+    {
+        return;
+    }
+    Vertice *v = aresta->destino;
+    aresta->proxEntrada = v->entradas;
+    v->entradas = aresta;
+    v->grauEntrada++;
+}
+
+/**
+ * Retira o arco da lista de entradas de seu destino, caso o índice de entradas esteja ativo.
+ * Deve ser chamado antes de o arco ser devolvido à arena.
+ */
+void Grafo::desligaEntrada(Aresta *aresta)
+{
+    if (!indiceEntradas)
+    {
+        return;
+    }
+    Vertice *v = aresta->destino;
+    Aresta *anterior = nullptr;
+    Aresta *e = v->entradas;
+    while (e != aresta)
+    {
+        anterior = e;
+        e = e->proxEntrada;
+    }
+    if (anterior == nullptr)
+    {
+        v->entradas = e->proxEntrada;
+    }
+    else
+    {
+        anterior->proxEntrada = e->proxEntrada;
+    }
+    v->grauEntrada--;
+}
+
+/**
+ * Retorna o número de arcos que chegam ao vértice com o id especificado, ou -1 caso ele não exista.
+ * Com o índice de entradas ativo a consulta é imediata; sem ele, todas as listas de adjacências são percorridas.
+ */
+int Grafo::grauEntrada(int idVertice)
+{
+    Vertice *v = getVertice(idVertice);
+    if (v == nullptr)
+    {
+        return -1;
+    }
+    if (indiceEntradas)
+    {
+        return v->grauEntrada;
+    }
+    int grau = 0;
+    for (Vertice *vertice : vertices)
+    {
+        for (Aresta *aresta = vertice->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            if (aresta->destino == v)
+            {
+                grau++;
+            }
+        }
+    }
+    return grau;
+}
+
 /**
  * - Retorna true se existir aresta ou arco definidos pelo par (u, v)
  * - Retorna false caso contrário:
@@ -95,14 +385,12 @@ bool Grafo::existeAresta(int idVerticeU, int idVerticeV)
  */
 Vertice *Grafo::getVertice(int idAlvo)
 {
-    for (Vertice *vertice : vertices)
+    int indice = encontraIndiceVertice(idAlvo);
+    if (indice == -1)
     {
-        if (vertice->id == idAlvo)
-        {
-            return vertice;
-        }
+        return nullptr;
     }
-    return nullptr;
+    return vertices[indice];
 }
 
 /**
@@ -113,7 +401,7 @@ void Grafo::adicionaAdjacencias(int idVerticeU, int idVerticeV, int peso)
 {
     Vertice *u = getVertice(idVerticeU);
     Vertice *v = getVertice(idVerticeV);
-    Aresta *e = new Aresta;
+    Aresta *e = arenaArestas.aloca();
     e->destino = v;
     e->origem = u;
     e->peso = peso;
@@ -131,6 +419,7 @@ void Grafo::adicionaAdjacencias(int idVerticeU, int idVerticeV, int peso)
         }
         aresta->prox = e;
     }
+    ligaEntrada(e);
 }
 
 /**
@@ -142,16 +431,23 @@ bool Grafo::adicionaVertice(int idVertice, int peso)
     {
         return false; // já existe o vértice com o id especificado
     }
-    Vertice *u = new Vertice;
+    Vertice *u = arenaVertices.aloca();
     u->id = idVertice;
     u->peso = peso;
+    u->indice = vertices.size();
+    indices[idVertice] = u->indice;
     vertices.push_back(u);
     u->arestas = nullptr;
+    u->entradas = nullptr;
+    u->grauEntrada = 0;
+    versao++;
     return true;
 }
 
 /**
  * Remove um vértice do grafo, caso exista, tratando de remover as adjacências por ele definidas.
+ * Com o índice de entradas ativo, apenas as listas dos predecessores do vértice são percorridas;
+ * sem ele, a remoção do arco que chega ao vértice é tentada a partir de cada um dos demais vértices.
  */
 bool Grafo::removeVertice(int idVertice)
 {
@@ -160,18 +456,35 @@ bool Grafo::removeVertice(int idVertice)
     {
         return false; // vértice buscado não existe
     }
-    for (Vertice *vertice : vertices)
+    if (indiceEntradas)
+    {
+        while (u->entradas != nullptr)
+        {
+            removeAresta(u->entradas->origem->id, idVertice);
+        }
+    }
+    else
     {
-        if (vertice->id != idVertice)
+        for (Vertice *vertice : vertices)
         {
-            removeAresta(vertice->id, idVertice);
+            if (vertice->id != idVertice)
+            {
+                removeAresta(vertice->id, idVertice);
+            }
         }
     }
     Aresta *aresta = u->arestas;
     liberaMemoriaArestas(aresta);
-    std::vector<Vertice *>::iterator it = std::find(vertices.begin(), vertices.end(), u);
-    vertices.erase(it);
-    delete u;
+    int indice = indices[idVertice];
+    vertices.erase(vertices.begin() + indice);
+    indices.erase(idVertice);
+    for (int i = indice; i < vertices.size(); i++)
+    {
+        vertices[i]->indice = i; // os vértices posteriores ao removido avançam uma posição
+        indices[vertices[i]->id] = i;
+    }
+    arenaVertices.libera(u);
+    versao++;
     return true;
 }
 
@@ -187,14 +500,141 @@ bool Grafo::adicionaAresta(int idVerticeU, int idVerticeV, int peso)
     }
     adicionaVertice(idVerticeU);
     adicionaVertice(idVerticeV);
+    bool alcanceAtualizado = versaoAlcance == versao; // falso também se algum vértice acabou de ser criado
     adicionaAdjacencias(idVerticeU, idVerticeV, peso);
     if (!direcionado)
     {
         adicionaAdjacencias(idVerticeV, idVerticeU, peso);
     }
+    versao++;
+    if (alcanceAtualizado && insereArcoAlcance(indices[idVerticeU], indices[idVerticeV]))
+    {
+        versaoAlcance = versao;
+    }
     return true;
 }
 
+/**
+ * Adiciona de uma só vez todas as arestas do lote, sem percorrer listas de adjacências a cada inserção.
+ * O lote é tratado como um conjunto de arestas, e não como uma sequência de chamadas a adicionaAresta:
+ * - os vértices são criados na ordem em que aparecem pela primeira vez no lote;
+ * - arcos repetidos (ou já existentes no grafo) são descartados, prevalecendo a primeira ocorrência e seu peso.
+ *   Em grafos não-direcionados (u, v) e (v, u) representam a mesma aresta;
+ * - laços (u, u) dependem de 'direcionado': em grafos direcionados são mantidos uma única vez, em grafos
+ *   não-direcionados são descartados (adicionaAresta, ao contrário, os registra duas vezes na lista de u).
+ * A deduplicação é feita ordenando as chaves das arestas junto de sua posição no lote e as listas de adjacências
+ * são montadas numa única passada, anexando cada arco ao fim da lista de sua origem.
+ * Retorna o número de arestas efetivamente adicionadas.
+ */
+int Grafo::adicionaArestas(const std::vector<ArestaLote> &lote)
+{
+    for (const ArestaLote &aresta : lote)
+    {
+        adicionaVertice(aresta.idOrigem);
+        adicionaVertice(aresta.idDestino);
+    }
+    bool alcanceAtualizado = versaoAlcance == versao;
+    // em grafos não-direcionados a chave de cada aresta é o par (menor, maior), de modo que (u, v) e (v, u) coincidem;
+    // arcos já existentes entram com posição -1 para prevalecerem sobre os do lote
+    std::vector<std::pair<long long, int>> chaves;
+    for (int i = 0; i < vertices.size(); i++)
+    {
+        for (Aresta *aresta = vertices[i]->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            chaves.push_back({chaveAresta(i, aresta->destino->indice), -1});
+        }
+    }
+    std::vector<int> origens(lote.size());
+    std::vector<int> destinos(lote.size());
+    for (int i = 0; i < lote.size(); i++)
+    {
+        origens[i] = indices[lote[i].idOrigem];
+        destinos[i] = indices[lote[i].idDestino];
+        if (origens[i] == destinos[i] && !direcionado)
+        {
+            continue;
+        }
+        chaves.push_back({chaveAresta(origens[i], destinos[i]), i});
+    }
+    std::sort(chaves.begin(), chaves.end());
+    std::vector<bool> aceita(lote.size(), false);
+    for (int k = 0; k < chaves.size(); k++)
+    {
+        bool repetida = k > 0 && chaves[k].first == chaves[k - 1].first;
+        if (!repetida && chaves[k].second != -1)
+        {
+            aceita[chaves[k].second] = true;
+        }
+    }
+    std::vector<Aresta *> caudas(vertices.size(), nullptr);
+    for (int i = 0; i < vertices.size(); i++)
+    {
+        for (Aresta *aresta = vertices[i]->arestas; aresta != nullptr; aresta = aresta->prox)
+        {
+            caudas[i] = aresta;
+        }
+    }
+    int adicionadas = 0;
+    for (int i = 0; i < lote.size(); i++)
+    {
+        if (!aceita[i])
+        {
+            continue;
+        }
+        anexaAdjacencia(caudas, origens[i], destinos[i], lote[i].peso);
+        if (!direcionado)
+        {
+            anexaAdjacencia(caudas, destinos[i], origens[i], lote[i].peso);
+        }
+        alcanceAtualizado = alcanceAtualizado && insereArcoAlcance(origens[i], destinos[i]);
+        adicionadas++;
+    }
+    if (adicionadas > 0)
+    {
+        versao++;
+        if (alcanceAtualizado)
+        {
+            versaoAlcance = versao;
+        }
+    }
+    return adicionadas;
+}
+
+/**
+ * Chave de ordenação do arco (u, v) usada na deduplicação de adicionaArestas.
+ */
+long long Grafo::chaveAresta(int u, int v)
+{
+    if (!direcionado && u > v)
+    {
+        std::swap(u, v);
+    }
+    return ((long long)u << 32) | v;
+}
+
+/**
+ * Anexa ao fim da lista de adjacências do vértice de posição u um arco para o vértice de posição v,
+ * mantendo em 'caudas' o último arco de cada lista.
+ */
+void Grafo::anexaAdjacencia(std::vector<Aresta *> &caudas, int u, int v, int peso)
+{
+    Aresta *e = arenaArestas.aloca();
+    e->origem = vertices[u];
+    e->destino = vertices[v];
+    e->peso = peso;
+    e->prox = nullptr;
+    if (caudas[u] == nullptr)
+    {
+        vertices[u]->arestas = e;
+    }
+    else
+    {
+        caudas[u]->prox = e;
+    }
+    caudas[u] = e;
+    ligaEntrada(e);
+}
+
 /**
  * Remove o arco definido pelo par ordenado (u,v) e, se o grafo for não-direcionado, a aresta definida pelo não ordenado de mesmos vértices.
  */
@@ -234,7 +674,9 @@ bool Grafo::removeAresta(int idVerticeU, int idVerticeV)
     {
         anterior->prox = e->prox;
     }
-    delete e;
+    desligaEntrada(e);
+    arenaArestas.libera(e);
+    versao++;
     if (direcionado)
     {
         return removida;
@@ -259,34 +701,15 @@ bool Grafo::removeAresta(int idVerticeU, int idVerticeV)
     {
         anterior->prox = e->prox;
     }
-    delete e;
+    desligaEntrada(e);
+    arenaArestas.libera(e);
     return removida;
 }
 
 /**
- * Método recursivo auxiliar para a funcionalidade de fecho transitivo direto.
- * Busca os sucessores dos sucessores do vértice solicitado.
- */
-void Grafo::auxFechoDireto(Vertice *vertice, std::set<int> &fecho, Grafo *grafoFecho)
-{
-    Aresta *aresta = vertice->arestas;
-    while (aresta != nullptr)
-    {
-        Vertice *sucessor = aresta->destino;
-        aresta = aresta->prox;
-        if (fecho.find(sucessor->id) != fecho.end())
-        {
-            continue;
-        }
-        fecho.insert(sucessor->id);
-        grafoFecho->adicionaAresta(vertice->id, sucessor->id);
-        auxFechoDireto(sucessor, fecho, grafoFecho);
-    }
-}
-
-/**
- * Através de um caminhamento em profundidade, tendo como início o vértice com o id especificado, imprime seu fecho
- * transitivo direto e retorna um grafo que represente tal fecho com os vértices e as arestas que o justificam.
+ * Através de um caminhamento em profundidade iterativo sobre o CSR, tendo como início o vértice com o id especificado,
+ * imprime seu fecho transitivo direto e retorna um grafo que represente tal fecho com os vértices e as arestas que o
+ * justificam (os arcos da árvore do caminhamento e, se o vértice estiver num ciclo, um arco que volta a ele).
  * - caso o grafo não seja direcionado ou não exista tal vértice no grafo, retorna um nullptr a ser tratado,
  *      visto que a operação não pode ser feita;
  * - caso o vértice exista, mas seu fecho seja vazia, retorna um grafo também vazio, visto que o próprio vértice não faz parte de seu fecho.
@@ -304,22 +727,34 @@ Grafo *Grafo::fechoTransitivoDireto(int idVertice)
         std::cout << "Nao existe no grafo vertice com o id especificado (" << idVertice << ")\n";
         return nullptr;
     }
-    Grafo *grafoFecho = new Grafo(direcionado, 0, 0);
-    std::set<int> fecho;
-    Aresta *aresta = v->arestas;
-    while (aresta != nullptr)
+    const GrafoCSR &csr = getCSR();
+    BuscaProfundidade::Caminhamento caminhamento;
+    BuscaProfundidade::caminha(csr, v->indice, caminhamento);
+    std::vector<ArestaLote> justificativas;
+    std::vector<int> fecho;
+    for (int k : caminhamento.arcosArvore)
     {
-        Vertice *sucessor = aresta->destino;
-        grafoFecho->adicionaAresta(v->id, sucessor->id);
-        fecho.insert(sucessor->id);
-        auxFechoDireto(sucessor, fecho, grafoFecho);
-        aresta = aresta->prox;
+        justificativas.push_back({csr.ids[csr.origens[k]], csr.ids[csr.destinos[k]], 0});
+        fecho.push_back(csr.ids[csr.destinos[k]]);
     }
+    // o vértice inicial fica na pilha durante toda a busca, então todo arco que chega a ele é de retorno
+    for (int k : caminhamento.arcosRetorno)
+    {
+        if (csr.destinos[k] == v->indice)
+        {
+            justificativas.push_back({csr.ids[csr.origens[k]], idVertice, 0});
+            fecho.push_back(idVertice);
+            break;
+        }
+    }
+    Grafo *grafoFecho = new Grafo(direcionado, 0, 0);
+    grafoFecho->adicionaArestas(justificativas);
     if (fecho.empty())
     {
         std::cout << "O fecho transitivo direto do vértice é vazio\n";
         return grafoFecho;
     }
+    std::sort(fecho.begin(), fecho.end());
     std::cout << "Fecho transitivo direto do vertice " << idVertice << ":\n { ";
     for (int idVerticeFecho : fecho)
     {
@@ -330,31 +765,10 @@ Grafo *Grafo::fechoTransitivoDireto(int idVertice)
 }
 
 /**
- * Retorna: true se foi adicionado ao menos novo vértice ao fecho.
- */
-bool Grafo::auxFechoIndireto(std::set<int> &fecho, std::vector<Vertice *> &naoUtilizados, Grafo *grafoFecho)
-{
-    bool adicionou = false;
-    for (std::vector<Vertice *>::iterator it = naoUtilizados.begin(); it != naoUtilizados.end(); it++)
-    {
-        for (int idVerticeFecho : fecho)
-        {
-            if (existeAresta((*it)->id, idVerticeFecho))
-            {
-                fecho.insert((*it)->id);
-                grafoFecho->adicionaAresta((*it)->id, idVerticeFecho);
-                naoUtilizados.erase(it);
-                adicionou = true;
-                break;
-            }
-        }
-    }
-    return adicionou;
-}
-
-/**
- * Através de um caminhamento em profundidade, tendo como início o vértice com o id especificado, imprime seu fecho
- * transitivo indireto e retorna um grafo que represente tal fecho com os vértices e as arestas que o justificam.
+ * Através de uma única busca em largura pelos arcos invertidos, tendo como início o vértice com o id especificado,
+ * imprime seu fecho transitivo indireto e retorna um grafo que represente tal fecho com os vértices e as arestas que o
+ * justificam (cada vértice alcançado aparece ligado ao vértice pelo qual foi descoberto).
+ * Os predecessores são obtidos das listas de entrada, caso o índice de entradas esteja ativo, ou do CSR reverso memorizado.
  * - caso o grafo não seja direcionado ou não exista tal vértice no grafo, retorna um nullptr a ser tratado,
  *      visto que a operação não pode ser feita;
  * - caso o vértice exista, mas seu fecho seja vazia, retorna um grafo também vazio, visto que o próprio vértice não faz parte de seu fecho.
@@ -373,32 +787,50 @@ Grafo *Grafo::fechoTransitivoIndireto(int idVertice)
         return nullptr;
     }
     Grafo *grafoFecho = new Grafo(direcionado, 0, 0);
-    std::vector<Vertice *> nao_utilizados;
-    for (Vertice *v : vertices)
-    {
-        if (v->id != u->id)
+    const GrafoCSR *reverso = indiceEntradas ? nullptr : &getCSRReverso();
+    std::vector<bool> visitado(vertices.size(), false);
+    std::vector<int> fila;
+    visitado[u->indice] = true;
+    fila.push_back(u->indice);
+    auto visita = [&](int predecessor, int sucessor)
+    {
+        if (visitado[predecessor])
         {
-            nao_utilizados.push_back(v);
+            return;
         }
-    }
-    std::set<int> fecho;
-    for (std::vector<Vertice *>::iterator it = nao_utilizados.begin(); it != nao_utilizados.end(); it++)
-    {
-        Vertice *v = *it;
-        if (existeAresta(v->id, idVertice))
+        visitado[predecessor] = true;
+        fila.push_back(predecessor);
+        grafoFecho->adicionaAresta(vertices[predecessor]->id, vertices[sucessor]->id);
+    };
+    for (int k = 0; k < fila.size(); k++)
+    {
+        int x = fila[k];
+        if (reverso == nullptr)
+        {
+            for (Aresta *aresta = vertices[x]->entradas; aresta != nullptr; aresta = aresta->proxEntrada)
+            {
+                visita(aresta->origem->indice, x);
+            }
+        }
+        else
         {
-            grafoFecho->adicionaAresta(v->id, u->id);
-            fecho.insert(v->id);
-            nao_utilizados.erase(it);
+            for (int a = reverso->inicio[x]; a < reverso->inicio[x + 1]; a++)
+            {
+                visita(reverso->destinos[a], x);
+            }
         }
     }
-    if (fecho.empty())
+    if (fila.size() == 1)
     {
         std::cout << "O fecho do vértice " << idVertice << " é o conjunto vazio." << std::endl;
         return grafoFecho;
     }
-    while (auxFechoIndireto(fecho, nao_utilizados, grafoFecho))
-        ;
+    std::vector<int> fecho;
+    for (int k = 1; k < fila.size(); k++)
+    {
+        fecho.push_back(vertices[fila[k]]->id);
+    }
+    std::sort(fecho.begin(), fecho.end());
     std::cout << "O fecho transitivo indireto do vértice " << idVertice << " é o conjunto composto pelos vértices:\n{ ";
     for (int id : fecho)
     {
@@ -409,81 +841,18 @@ Grafo *Grafo::fechoTransitivoIndireto(int idVertice)
     return grafoFecho;
 }
 
+/**
+ * Retorna a posição no vetor de vértices do vértice com o id especificado, caso exista.
+ * Caso contrário, retorna -1.
+ */
 int Grafo::encontraIndiceVertice(int id)
 {
-    for (int i = 0; i < vertices.size(); i++)
+    std::unordered_map<int, int>::iterator it = indices.find(id);
+    if (it == indices.end())
     {
-        if (vertices[i]->id == id)
-        {
-            return i;
-        }
-    }
-    return -1;
-}
-
-void Grafo::inicializaMatrizDistancias(std::vector<std::vector<int>> &distancias, int ordem)
-{
-    for (int i = 0; i < ordem; i++)
-    {
-        std::vector<int> linhaInicial;
-        for (int j = 0; j < ordem; j++)
-        {
-            if (i == j)
-            {
-                linhaInicial.push_back(0);
-            }
-            else
-            {
-                linhaInicial.push_back(INF);
-            }
-        }
-        distancias.push_back(linhaInicial);
-    }
-    for (int i = 0; i < ordem; i++)
-    {
-        Vertice *u = vertices[i];
-        Aresta *aresta = u->arestas;
-        while (aresta != nullptr)
-        {
-            Vertice *v = aresta->destino;
-            int j = encontraIndiceVertice(v->id);
-            distancias[i][j] = aresta->peso;
-            aresta = aresta->prox;
-        }
-    }
-}
-
-void Grafo::atualizaMatrizDistancias(std::vector<std::vector<int>> &distancias, int ordem, int indice)
-{
-    if (indice == ordem)
-    {
-        return;
-    }
-    for (int i = 0; i < ordem; i++)
-    {
-        if (i == indice)
-        {
-            continue;
-        }
-        for (int j = 0; j < ordem; j++)
-        {
-            if (j == indice)
-            {
-                continue;
-            }
-            int distanciaAtual = distancias[i][j];
-            int distanciaIntermediariaA = distancias[i][indice];
-            int distanciaIntermediariaB = distancias[indice][j];
-            if (distanciaIntermediariaA == INF || distanciaIntermediariaB == INF)
-            {
-                continue; // evita cálculos com unsafe integers
-            }
-            int novaDistancia = distanciaIntermediariaA + distanciaIntermediariaB;
-            distanciaAtual = std::min(distanciaAtual, novaDistancia);
-            distancias[i][j] = distanciaAtual;
-        }
+        return -1;
     }
-    atualizaMatrizDistancias(distancias, ordem, indice + 1);
+    return it->second;
 }
 
 /**
@@ -509,134 +878,65 @@ int Grafo::custo(int idVerticeU, int idVerticeV)
     return INF;
 }
 
-/**
- * Retorna a matriz representativa dos caminhos mínimos entre quaisquer vértices do grafo.
- * distancias(i,j) = INF -> não existe qualquer caminho entre os dois vértices;
- * distancias(i,j) = 0 -> caminho não é permitido (self-loop), só ocorre quando i = j.
- */
-std::vector<std::vector<int>> Grafo::getMatrizDistancias()
-{
-    std::vector<std::vector<int>> distancias;
-    inicializaMatrizDistancias(distancias, vertices.size());
-    atualizaMatrizDistancias(distancias, vertices.size(), 0);
-    return distancias;
-}
-
-void Grafo::inicializaMatrizesFloyd(std::vector<std::vector<int>> &distancias, std::vector<std::vector<int>> &proximos, int ordem)
-{
-    for (int i = 0; i < ordem; i++)
-    {
-        std::vector<int> linhaDistancias;
-        std::vector<int> linhaProximos;
-        for (int j = 0; j < ordem; j++)
-        {
-            if (i == j)
-            {
-                linhaDistancias.push_back(0);
-                linhaProximos.push_back(j);
-            }
-            else
-            {
-                linhaDistancias.push_back(INF);
-                linhaProximos.push_back(-1);
-            }
-        }
-        distancias.push_back(linhaDistancias);
-        proximos.push_back(linhaProximos);
-    }
-    for (int i = 0; i < ordem; i++)
-    {
-        Vertice *u = vertices[i];
-        Aresta *aresta = u->arestas;
-        while (aresta != nullptr)
-        {
-            Vertice *v = aresta->destino;
-            int j = encontraIndiceVertice(v->id);
-            distancias[i][j] = aresta->peso; // custo é o peso da aresta
-            proximos[i][j] = j;              // o próximo é o vértice de destino da aresta
-            aresta = aresta->prox;
-        }
-    }
-}
-
-void Grafo::atualizaMatrizesFloyd(std::vector<std::vector<int>> &distancias, std::vector<std::vector<int>> &proximos, int ordem, int indice)
-{
-    if (indice == ordem)
-    {
-        return;
-    }
-    for (int i = 0; i < ordem; i++)
-    {
-        if (i == indice)
-        {
-            continue; // impossível provocar alguma melhora
-        }
-        for (int j = 0; j < ordem; j++)
-        {
-            if (j == indice)
-            {
-                continue; // impossível provocar alguma melhora
-            }
-            int distanciaAtual = distancias[i][j];
-            if (distancias[i][indice] == INF || distancias[indice][j] == INF)
-            {
-                continue; // evita cálculos imprevisíveis e irrelevantes
-            }
-            int novaDistancia = distancias[i][indice] + distancias[indice][j];
-            if (novaDistancia < distanciaAtual)
-            {
-                distancias[i][j] = novaDistancia;
-                proximos[i][j] = proximos[i][indice];
-            }
-        }
-    }
-    atualizaMatrizesFloyd(distancias, proximos, ordem, indice + 1);
-}
-
 /**
  * Calcula o caminho mínimo entre dois vértices do grafo.
- * - Caso o grafo não possua arestas ponderadas, retorna um nullptr
+ * - Caso o grafo não possua arestas ponderadas, o caminho é calculado por busca em largura e seu custo é o número de arestas
  * - Caso um ou ambos os vértices não exista, retorna um nullptr
  * - Caso não exista caminho entre os vértices, retorna um grafo vazio
- * - Caso exista caminho, retorna um grafo com as arestas que compõem o caminho mínimo
- */
-Grafo *Grafo::caminhoMinimoFloyd(int idVerticeU, int idVerticeV)
-{
-    if (!arestasPonderadas)
-    {
-        std::cout << "As operacoes de caminho minimo nao sao permitidas para grafos sem ponderacao nas arestas" << std::endl;
-        return nullptr;
-    }
-    int u = encontraIndiceVertice(idVerticeU);
+ * - Caso exista caminho, retorna um grafo com as arestas que compõem o caminho mínimo
+ */
+Grafo *Grafo::caminhoMinimoFloyd(int idVerticeU, int idVerticeV)
+{
+    const GrafoCSR &csr = getCSR();
+    int u = csr.indice(idVerticeU);
     if (u == -1)
     {
         std::cout << "Nao existe vertice de id " << idVerticeU << std::endl;
         return nullptr;
     }
-    int v = encontraIndiceVertice(idVerticeV);
+    int v = csr.indice(idVerticeV);
     if (v == -1)
     {
         std::cout << "Nao existe vertice de id " << idVerticeV << std::endl;
         return nullptr;
     }
     std::cout << "Calculando caminho mínimo entre os vértices " << idVerticeU << ":" << u << " e " << idVerticeV << ":" << v << '\n';
-    int ordem = vertices.size();
-    std::vector<std::vector<int>> distancias; // controla o caminho mínimo entre i e j
-    std::vector<std::vector<int>> proximos;   // controla qual é o próximo no caminho mínimo de i a j
-    inicializaMatrizesFloyd(distancias, proximos, vertices.size());
-    atualizaMatrizesFloyd(distancias, proximos, vertices.size(), 0);
-    int distanciaUV = distancias[u][v];
+    int distanciaUV;
+    std::vector<int> indicesCaminho;
+    if (arestasPonderadas)
+    {
+        if (versaoFloyd != versao) // as matrizes só são recalculadas se o grafo mudou desde a última consulta
+        {
+            Floyd::inicializaDistancias(csr, distanciasFloyd);
+            Floyd::inicializaProximos(csr, proximosFloyd);
+            Floyd::executa(distanciasFloyd, &proximosFloyd, threads);
+            versaoFloyd = versao;
+        }
+        distanciaUV = distanciasFloyd.linha(u)[v];
+        if (distanciaUV != INF)
+        {
+            indicesCaminho.push_back(u);
+            for (int atual = u; atual != v; )
+            {
+                atual = proximosFloyd.linha(atual)[v];
+                indicesCaminho.push_back(atual);
+            }
+        }
+    }
+    else
+    {
+        distanciaUV = buscaCaminhoMinimo(csr, u, v, indicesCaminho);
+    }
     if (distanciaUV == INF)
     {
         std::cout << "Nao há qualquer caminho entre " << idVerticeU << " e " << idVerticeV << '\n';
         return new Grafo(direcionado, 0, 0);
     }
     std::cout << "O custo do caminho minimo entre os vertices " << idVerticeU << " e " << idVerticeV << " é: " << distanciaUV << '\n';
-    std::vector<int> caminho = {vertices[u]->id};
-    while (u != v)
+    std::vector<int> caminho;
+    for (int indice : indicesCaminho)
     {
-        u = proximos[u][v];
-        caminho.push_back(vertices[u]->id);
+        caminho.push_back(csr.ids[indice]);
     }
     Grafo *grafoCaminho = new Grafo(direcionado, 0, 0);
     for (int i = 0; i < caminho.size() - 1; i++)
@@ -648,437 +948,317 @@ Grafo *Grafo::caminhoMinimoFloyd(int idVerticeU, int idVerticeV)
     return grafoCaminho;
 }
 
-/**
- * parâmetros:
- * - distanciasParaOutros: vetor contendo as distâncias do vértice para todos os vértices do grafo.
- * obs.: distância 0 indica selfloop e distância INF indica que não há caminho entre os vértices.
- */
-int Grafo::getExcentricidade(const std::vector<int> &distanciasParaOutros)
-{
-    int excentricidade = MIN;
-    for (int distancia : distanciasParaOutros)
-    {
-        if (distancia != 0 && distancia != INF && distancia > excentricidade)
-        {
-            excentricidade = distancia;
-        }
-    }
-    return excentricidade;
-}
-
 /**
  * Analisa um grafo e os caminhos entre seus vértices em busca de seu centro, periferia, diâmetro e raio.
  * - Diâmetro: maior excentricidade do grafo;
  * - Raio: menor excentricidade do grafo.
  * - Centro: vértice com menor excentricidade, ou seja, vértices que possuem excentricidade igual ao raio;
  * - Periferia: vértice com maior excentricidade, ou seja, vértices que possuem excentricidade igual ao diâmetro.
+ * Em grafos sem ponderação nas arestas, as distâncias são os números de arestas dos caminhos.
  */
 void Grafo::analiseExcentricidade()
 {
-    if (!arestasPonderadas)
-    {
-        std::cout << "Operacao nao permitida para grafos com arestas nao ponderadas" << std::endl;
-        return;
-    }
-    std::map<int, std::vector<int>> excentricidades;
-    int raio = INF;
-    int diametro = MIN;
-    auto distancias = getMatrizDistancias();
-    for (int i = 0; i < distancias.size(); i++)
+    const GrafoCSR &csr = getCSR();
+    if (versaoExtremos != versao)
     {
-        int e = getExcentricidade(distancias[i]);
-        if (e == MIN)
-        {
-            continue;
-        }
-        if (raio > e)
-        {
-            raio = e;
-        }
-        if (diametro < e)
-        {
-            diametro = e;
-        }
-        excentricidades[e].push_back(i);
+        extremosMemorizados = Excentricidade::calculaExtremos(csr, threads);
+        versaoExtremos = versao;
     }
-    if (raio == INF)
+    const Excentricidade::Extremos &extremos = extremosMemorizados;
+    if (extremos.raio == INF)
     {
         std::cout << "Nao ha caminho de um vertice para qualquer outro vertice no grafo" << std::endl;
         return;
     }
-    auto centro = excentricidades[raio];
-    auto periferia = excentricidades[diametro];
-    std::cout << "O raio do grafo eh " << raio << " e seu centro eh composto pelos vertices {";
-    for (int i = 0; i < centro.size(); i++)
+    std::cout << "O raio do grafo eh " << extremos.raio << " e seu centro eh composto pelos vertices {";
+    for (int i = 0; i < extremos.centro.size(); i++)
     {
-        std::cout << ' ' << vertices[i]->id << ' ';
+        std::cout << ' ' << csr.ids[extremos.centro[i]] << ' ';
     }
     std::cout << "}\n";
-    std::cout << "O diametro do grafo eh " << diametro << " e sua periferia eh composta pelos vertices {";
-    for (int i = 0; i < periferia.size(); i++)
+    std::cout << "O diametro do grafo eh " << extremos.diametro << " e sua periferia eh composta pelos vertices {";
+    for (int i = 0; i < extremos.periferia.size(); i++)
     {
-        std::cout << ' ' << vertices[i]->id << ' ';
+        std::cout << ' ' << csr.ids[extremos.periferia[i]] << ' ';
     }
     std::cout << '}' << std::endl;
 }
 
+/**
+ * Devolve à arena de arestas todos os nós da lista de adjacências iniciada em 'inicio'.
+ */
 void Grafo::liberaMemoriaArestas(Aresta *inicio)
 {
     Aresta *aresta = inicio;
     while (aresta != nullptr)
     {
         Aresta *prox = aresta->prox;
-        delete aresta;
+        desligaEntrada(aresta);
+        arenaArestas.libera(aresta);
         aresta = prox;
     }
 }
 
 /**
- * Método auxiliar que percorre o grafo em profundidade recursivamente.
- * Parâmetros:
- * - u: vértice sendo visitado
- * - pai: vértice que antecede u na busca
- * - cor: mapa que indica se o vértice foi visitado (2), se não (0) ou se está em processo de visita (1).
- * - arvore: grafo que representa a árvore de caminhamento em profundidade.
+ * Imprime no terminal a árvore de caminhamento em profundidade do grafo partindo do vértice especificado e a
+ * devolve em 'caminhamento' (pré-ordem e posições no CSR dos arcos de árvore e de retorno), válida enquanto o grafo
+ * não for modificado.
+ * - Caso o grafo seja vazio, retorna false;
+ * - Caso o vértice especificado não exista, retorna false;
+ * - Aresta de retorno: aresta que liga um vértice a um ancestral na árvore de caminhamento em profundidade.
  */
-void Grafo::caminhaProfundidade(Vertice *u, std::map<Vertice *, int> &cor, Grafo *arvore)
+bool Grafo::caminhamentoProfundidade(int idVerticeInicio, BuscaProfundidade::Caminhamento &caminhamento)
 {
-    cor[u] = 1;
-    Aresta *e = u->arestas;
-    while (e != nullptr)
+    if (vertices.empty())
     {
-        Vertice *v = e->destino;
-        if (cor[v] == 0)
-        {
-            arvore->adicionaAresta(u->id, v->id);
-            caminhaProfundidade(v, cor, arvore);
-        }
-        else if (cor[v] == 1)
-        {
-            arvore->adicionaAresta(u->id, v->id, -1);
-        }
-        e = e->prox;
+        std::cout << "Nao há vertices no grafo" << std::endl;
+        return false;
+    }
+    const GrafoCSR &csr = getCSR();
+    int inicial = csr.indice(idVerticeInicio);
+    if (inicial == -1)
+    {
+        std::cout << "O vértice especificado não existe" << std::endl;
+        return false;
     }
-    cor[u] = 2;
+    BuscaProfundidade::caminha(csr, inicial, caminhamento);
+    Printer::printArvoreCaminhamento(csr, caminhamento);
+    return true;
 }
 
 /**
- * Imprime no terminal e retorna como um grafo a árvore de caminhamento em
- * profundidade do grafo partindo do vértice especificado.
- * - Caso o grafo seja vazio, retorna um nullptr;
- * - Caso o vértice especificado não exista, retorna um nullptr;
- * Obs.: a árvore de caminhamento em profundidade é um grafo que representa as arestas percorridas
- * e usa arestas com peso -1 para indicar arestas de retorno.
- * - Aresta de retorno: aresta que liga um vértice a um ancestral na árvore de caminhamento em profundidade.
+ * Retorna um grafo com os vértices de articulação do grafo original, obtidos junto das pontes e das componentes
+ * biconexas por uma única busca de Tarjan sobre o CSR.
+ * - Caso o grafo seja direcionado ou não possua vértices, retorna um nullptr.
  */
-Grafo *Grafo::caminhamentoProfundidade(int idVerticeInicio)
+Grafo *Grafo::verticesDeArticulacao()
 {
-    if (vertices.empty())
+    if (direcionado)
     {
-        std::cout << "Nao há vertices no grafo" << std::endl;
+        std::cout << "O grafo deve ser não direcionado" << std::endl;
         return nullptr;
     }
-    Vertice *inicial = getVertice(idVerticeInicio);
-    if (inicial == nullptr)
+    if (vertices.empty())
     {
-        std::cout << "O vértice especificado não existe" << std::endl;
+        std::cout << "O grafo nao possui vertices" << std::endl;
         return nullptr;
     }
-    Grafo *arvore = new Grafo(1, 0, 0); // deve ser direcionando para representar a árvore corretamente com as arestas de retorno
-    arvore->adicionaVertice(inicial->id);
-    int tempo = 0;
-    std::map<Vertice *, int> cor;
-    for (Vertice *v : vertices)
+    const GrafoCSR &csr = getCSR();
+    Biconexas::Resultado resultado;
+    Biconexas::calcula(csr, resultado);
+    std::cout << "Componentes conexas do grafo: " << resultado.raizes.size() << std::endl;
+    std::vector<std::vector<int>> articulacoesComponentes(resultado.raizes.size());
+    for (int v = 0; v < csr.ordem(); v++)
     {
-        cor[v] = 0;
+        if (resultado.articulacoes[v])
+        {
+            articulacoesComponentes[resultado.componentes[v]].push_back(csr.ids[v]);
+        }
     }
-    caminhaProfundidade(inicial, cor, arvore);
-    Printer::printArvoreCaminhamento(vertices);
-    return arvore;
+    Grafo *grafoArticulacoes = new Grafo(direcionado, 0, 0);
+    for (size_t componente = 0; componente < resultado.raizes.size(); componente++)
+    {
+        std::cout << "Componente conexa comecando em " << csr.ids[resultado.raizes[componente]] << std::endl;
+        std::sort(articulacoesComponentes[componente].begin(), articulacoesComponentes[componente].end());
+        for (int id : articulacoesComponentes[componente])
+        {
+            grafoArticulacoes->adicionaVertice(id);
+        }
+    }
+    std::cout << "Pontes do grafo: " << resultado.pontes.size() / 2 << std::endl;
+    std::cout << "Componentes biconexas do grafo: " << resultado.numeroBlocos() << std::endl;
+    return grafoArticulacoes;
 }
 
 /**
- * Retorna um set de set de vértices, onde cada set interno representa uma componente conexa do grafo.
+ * Imprime as componentes fortemente conexas do grafo e retorna o grafo condensado: um DAG com um vértice por
+ * componente, numeradas em ordem topológica e ponderadas pelo número de vértices da componente.
+ * - Caso o grafo não seja direcionado, retorna um nullptr.
  */
-std::set<std::set<Vertice *>> Grafo::getComponentesConexas()
+Grafo *Grafo::componentesFortementeConexas()
 {
-    std::set<std::set<Vertice *>> componentes;
-    std::map<Vertice *, bool> usados;
-    for (Vertice *v : vertices)
+    if (!direcionado)
     {
-        usados[v] = false;
+        std::cout << "O grafo deve ser direcionado" << std::endl;
+        return nullptr;
     }
-    for (Vertice *v : vertices)
+    const GrafoCSR &csr = getCSR();
+    const ComponentesFortes::Condensacao &condensacao = getCondensacao();
+    std::cout << "Componentes fortemente conexas do grafo: " << condensacao.numero() << std::endl;
+    for (int c = 0; c < condensacao.numero(); c++)
     {
-        if (!usados[v])
+        std::cout << "Componente " << c << ": { ";
+        for (int i = condensacao.inicioMembros[c]; i < condensacao.inicioMembros[c + 1]; i++)
         {
-            std::set<Vertice *> componente = buscaComponente(v, usados);
-            componentes.insert(componente);
+            std::cout << csr.ids[condensacao.membros[i]] << ' ';
         }
+        std::cout << '}' << std::endl;
     }
-    return componentes;
+    return new Grafo(condensacao.dag);
 }
 
 /**
- * Através de uma busca em profundidade, encontra quais são os vértices de articulação
- * da componente conexa que contém o vértice passado como argumento.
- * Parâmetros:
- * - articulacoes: conjunto que armazena os vértices de articulação;
- * - v: vértice de início da busca;
- * - pai: vértice pai do vértice de início da busca;
- * - tempoEntrada: mapa que armazena o tempo de entrada de cada vértice na busca;
- * - minimo: mapa que armazena o menor tempo de entrada dos vértices alcançáveis por cada vértice;
- * - visitado: mapa que indica quais vértices já foram visitados;
- * - cronometro: contador que armazena o tempo de entrada dos vértices.
+ * Calcula o fecho transitivo direto de todos os vértices de uma só vez (matriz de alcance sobre o grafo condensado)
+ * e retorna o número de pares (u, v) com v alcançável a partir de u. Gravações posteriores por
+ * salvaFechoTransitivo() reaproveitam a matriz enquanto o grafo não for modificado.
  */
-void Grafo::buscaProfundidadeArticulacoes(std::set<int> &articulacoes, Vertice *v, Vertice *pai,
-                                          std::map<int, int> &tempoEntrada, std::map<int, int> &minimo, std::map<int, bool> visitado, int &cronometro)
+long long Grafo::fechoTransitivoCompleto()
 {
-    visitado[v->id] = true;
-    cronometro++;
-    tempoEntrada[v->id] = cronometro;
-    minimo[v->id] = cronometro;
-    int filhos = 0;
-    Aresta *aresta = v->arestas;
-    while (aresta != nullptr)
+    return getFechoTransitivo().pares();
+}
+
+/**
+ * Retorna true se o vértice de id idVerticeV pertence ao fecho transitivo direto do vértice de id idVerticeU, ou
+ * seja, se existe caminho com ao menos uma aresta de u até v. Retorna false se algum dos vértices não existir.
+ * A consulta utiliza o índice de alcançabilidade, construído na primeira chamada e mantido nas inserções de arestas.
+ */
+bool Grafo::alcanca(int idVerticeU, int idVerticeV)
+{
+    int u = encontraIndiceVertice(idVerticeU);
+    int v = encontraIndiceVertice(idVerticeV);
+    if (u == -1 || v == -1)
     {
-        Vertice *u = aresta->destino;
-        if (u == pai)
-        {
-            aresta = aresta->prox;
-            continue;
-        }
-        if (visitado[u->id])
-        {
-            minimo[v->id] = std::min(minimo[v->id], tempoEntrada[u->id]);
-        }
-        else
-        {
-            buscaProfundidadeArticulacoes(articulacoes, u, v, tempoEntrada, minimo, visitado, cronometro);
-            minimo[v->id] = std::min(minimo[v->id], minimo[u->id]);
-            if (minimo[u->id] >= tempoEntrada[v->id] && pai != nullptr)
-            {
-                articulacoes.insert(v->id);
-            }
-            filhos++;
-        }
-        aresta = aresta->prox;
+        return false;
     }
+    return getIndiceAlcance().alcanca(u, v);
 }
 
 /**
- * Método auxiliar para a busca dos vértices de articulação de uma componente conexa.
- * Parâmetros:
- * - v: vértice de início da busca;
- * - componente: conjunto que armazena os vértices da componente conexa.
- * Retorna um set de inteiros, com os IDs dos vértices de articulação.
+ * Grava a matriz de alcance de todos os vértices no arquivo indicado. Retorna false caso a escrita falhe.
  */
-std::set<int> Grafo::encontraArticulacoesComponente(Vertice *v, std::set<Vertice *> componente)
+bool Grafo::salvaFechoTransitivo(const std::string &caminho)
 {
-    int cronometro = 0;
-    std::set<int> articulacoes;
-    std::map<int, int> tempoEntrada, minimo;
-    std::map<int, bool> visitado;
-    for (Vertice *v : componente) // inicializações
-    {
-        tempoEntrada[v->id] = -1;
-        minimo[v->id] = -1;
-        visitado[v->id] = false;
-    }
-    buscaProfundidadeArticulacoes(articulacoes, v, nullptr, tempoEntrada, minimo, visitado, cronometro);
-    return articulacoes;
+    return FechoTransitivo::salva(getFechoTransitivo(), getCSR(), caminho);
 }
 
 /**
- * Retorna um grafo com os vértices de articulação do grafo original.
- * - Caso o grafo não possua vértices, retorna um nullptr.
+ * Constrói (ou reaproveita) o índice de alcançabilidade do grafo e retorna o total de rótulos 2-hop guardados.
  */
-Grafo *Grafo::verticesDeArticulacao()
+long long Grafo::preparaIndiceAlcance()
 {
-    if (direcionado)
-    {
-        std::cout << "O grafo deve ser não direcionado" << std::endl;
-        return nullptr;
-    }
-    if (vertices.empty())
-    {
-        std::cout << "O grafo nao possui vertices" << std::endl;
-        return nullptr;
-    }
-    Grafo *grafoArticulacoes = new Grafo(direcionado, 0, 0);
-    std::set<std::set<Vertice *>> componentes = getComponentesConexas();
-    std::cout << "Componentes conexas do grafo: " << componentes.size() << std::endl;
-    for (std::set<std::set<Vertice *>>::iterator it = componentes.begin(); it != componentes.end(); it++)
-    {
-        std::set<Vertice *> componente = *it;
-        int cronometro = 0;
-
-        Vertice *v = *componente.begin();
-        std::cout << "Componente conexa comecando em " << v->id << std::endl;
-        std::set<int> articulacoes = encontraArticulacoesComponente(v, componente);
-        for (int id : articulacoes)
-        {
-            grafoArticulacoes->adicionaVertice(id);
-        }
-    }
-    return grafoArticulacoes;
+    return getIndiceAlcance().rotulos();
 }
 
 /**
- * Método auxiliar para a busca em profundidade de uma componente conexa.
- * O método é recursivo e, a cada chamada, adiciona um vértice ao conjunto que representa a componente conexa.
- * Parâmetros:
- * - v: vértice de início da busca;
- * - usados: mapa que indica quais vértices já foram visitados;
- * - componente: conjunto que armazena os vértices da componente conexa, inicialmente, contem apenas o vértice da primeira chamada.
+ * Grava o índice de alcançabilidade no arquivo indicado, construindo-o antes se necessário.
+ * Retorna false caso a escrita falhe.
  */
-void Grafo::buscaProfundidadeComponente(Vertice *v, std::map<Vertice *, bool> &usados, std::set<Vertice *> &componente)
+bool Grafo::salvaIndiceAlcance(const std::string &caminho)
 {
-    Aresta *aresta = v->arestas;
-    while (aresta != nullptr)
-    {
-        Vertice *u = aresta->destino;
-        if (!usados[u])
-        {
-            usados[u] = true;
-            componente.insert(u);
-            buscaProfundidadeComponente(u, usados, componente);
-        }
-        aresta = aresta->prox;
-    }
+    const IndiceAlcance::Indice &indice = getIndiceAlcance();
+    return IndiceAlcance::salva(indice, getCSR(), caminho);
 }
 
 /**
- * Encontra e retorna a componente conexa do grafo que contém o vértice passado como argumento.
- * Parâmetros:
- * - v: vértice de início da busca;
- * - usados: mapa que indica quais vértices já foram visitados.
+ * Carrega um índice de alcançabilidade gravado anteriormente para este mesmo grafo. Retorna false caso o arquivo
+ * seja inválido ou corresponda a outro grafo.
  */
-std::set<Vertice *> Grafo::buscaComponente(Vertice *v, std::map<Vertice *, bool> &usados)
+bool Grafo::carregaIndiceAlcance(const std::string &caminho)
 {
-    usados[v] = true;
-    std::set<Vertice *> componente;
-    componente.insert(v);
-    buscaProfundidadeComponente(v, usados, componente);
-    return componente;
+    if (!IndiceAlcance::carrega(caminho, getCSR(), indiceAlcance))
+    {
+        return false;
+    }
+    versaoAlcance = versao;
+    return true;
 }
 
 /**
- * Método auxiliar para a obtenção do caminho mínimo entre dois vértices do grafo utilizando
- * o algoritmo de Moore-Dijkstra.
+ * Calcula o caminho mínimo entre os índices densos 'origem' e 'destino'. Se o grafo for ponderado nas arestas:
+ * - sem arcos negativos, pela hierarquia de contração, se preparada; senão, por Dijkstra bidirecional, guiado
+ *   pelos marcos ALT quando estes estiverem preparados, ou por delta-stepping paralelo em grafos grandes sem marcos;
+ * - com arcos negativos, por Moore-Dijkstra.
+ * Caso contrário, por busca em largura, em número de arestas.
+ * Preenche 'caminho' com os índices dos vértices da origem ao destino e retorna o custo, ou INF se não houver caminho.
  */
-bool Grafo::existeVerticeAberto(std::map<Vertice *, bool> &abertos)
+int Grafo::buscaCaminhoMinimo(const GrafoCSR &csr, int origem, int destino, std::vector<int> &caminho)
 {
-    for (std::map<Vertice *, bool>::iterator it = abertos.begin(); it != abertos.end(); it++)
+    caminho.clear();
+    int custoCaminho;
+    if (arestasPonderadas)
     {
-        if (it->second)
+        if (versaoHierarquia == versao) // a hierarquia só é preparada ou carregada sem arcos negativos
         {
-            return true;
+            return HierarquiaContracao::busca(hierarquia, origem, destino, caminho);
+        }
+        bool negativos = possuiPesosNegativos();
+        bool possuiMarcos = versaoMarcos == versao && marcos.quantidade() > 0;
+        if (!negativos && (possuiMarcos || !DeltaStepping::compensa(csr, threads)))
+        {
+            return CaminhoBidirecional::busca(csr, getCSRReverso(), possuiMarcos ? &marcos : nullptr, origem, destino, caminho);
+        }
+        CaminhoMinimo::EspacoDijkstra &espaco = CaminhoMinimo::getEspacoThread();
+        if (negativos)
+        {
+            CaminhoMinimo::dijkstra(csr, origem, espaco);
+        }
+        else
+        {
+            DeltaStepping::executa(csr, origem, destino, larguraBalde, threads, espaco);
+        }
+        custoCaminho = espaco.distancia(destino);
+        for (int atual = destino; custoCaminho != INF && atual != -1; atual = espaco.predecessor(atual))
+        {
+            caminho.push_back(atual);
+        }
+    }
+    else
+    {
+        BuscaLargura::EspacoBusca &espaco = BuscaLargura::getEspacoThread();
+        BuscaLargura::busca(csr, nullptr, origem, destino, espaco);
+        custoCaminho = espaco.distancias[destino];
+        for (int atual = destino; custoCaminho != INF && atual != -1; atual = espaco.predecessores[atual])
+        {
+            caminho.push_back(atual);
         }
     }
-    return false;
+    std::reverse(caminho.begin(), caminho.end());
+    return custoCaminho;
 }
 
 /**
  * Calcula o caminho mínimo entre dois vértices do grafo utilizando o algoritmo
  * de Moore-Dijkstra adaptado para arestas de custo negativo.
- * - Caso o grafo não possua arestas ponderadas, retorna um nullptr
+ * - Sem arestas negativas, a busca é bidirecional e utiliza a hierarquia de contração (preparaHierarquia/carregaHierarquia)
+ *   ou os marcos (preparaMarcos/carregaMarcos), se houver
+ * - Caso o grafo não possua arestas ponderadas, o custo é o número de arestas do caminho
  * - Caso um ou ambos os vértices não exista, retorna um nullptr
  * - Caso não exista caminho entre os vértices, retorna um grafo vazio
  * Obs.: comportamento indefinido para grafos com ciclos negativos.
  */
 Grafo *Grafo::caminhoMinimoDijkstra(int idOrigem, int idDestino)
 {
-    if (!arestasPonderadas)
-    {
-        std::cout << "O grafo ter arestas ponderadas\n";
-        return nullptr;
-    }
-    Vertice *v = getVertice(idOrigem);
-    if (v == nullptr)
+    const GrafoCSR &csr = getCSR();
+    int origem = csr.indice(idOrigem);
+    if (origem == -1)
     {
         std::cout << "Nao existe no grafo vertice com o id especificado (" << idOrigem << ")\n";
         return nullptr;
     }
-    if (getVertice(idDestino) == nullptr)
+    int destino = csr.indice(idDestino);
+    if (destino == -1)
     {
         std::cout << "Nao existe no grafo vertice com o id especificado (" << idDestino << ")\n";
         return nullptr;
     }
-    std::map<Vertice *, bool> abertos;
-    for (Vertice *vertice : vertices)
-    {
-        abertos[vertice] = true;
-    }
-    std::map<Vertice *, int> distancias;
-    std::map<Vertice *, Vertice *> predecessores;
-    for (Vertice *vertice : vertices)
-    {
-        distancias[vertice] = INF;
-        predecessores[vertice] = nullptr;
-    }
-    distancias[v] = 0;
-    predecessores[v] = nullptr;
-    Aresta *e = v->arestas;
-    while (e != nullptr)
-    {
-        distancias[e->destino] = e->peso;
-        predecessores[e->destino] = v;
-        e = e->prox;
-    }
-    while (existeVerticeAberto(abertos))
-    {
-        Vertice *verticeAtual = nullptr;
-        int menorDistancia = INF;
-        for (Vertice *vertice : vertices)
-        {
-            if (!abertos[vertice])
-            {
-                continue;
-            }
-            if (distancias[vertice] < menorDistancia)
-            {
-                menorDistancia = distancias[vertice];
-                verticeAtual = vertice;
-            }
-        }
-        if (verticeAtual == nullptr)
-        {
-            break;
-        }
-        abertos[verticeAtual] = false;
-        Aresta *e = verticeAtual->arestas;
-        while (e != nullptr)
-        {
-            int distancia = distancias[verticeAtual] + e->peso;
-            if (distancia < distancias[e->destino])
-            {
-                distancias[e->destino] = distancia;
-                abertos[e->destino] = true;
-                predecessores[e->destino] = verticeAtual;
-            }
-            e = e->prox;
-        }
-    }
-
-    Vertice *atual = getVertice(idDestino);
-    if (distancias[atual] == INF)
+    std::vector<int> indicesCaminho;
+    int custoCaminho = buscaCaminhoMinimo(csr, origem, destino, indicesCaminho);
+    if (custoCaminho == INF)
     {
         std::cout << "Não existe qualquer caminho entre: " << idOrigem << " e " << idDestino;
         return new Grafo(direcionado, 0, 0);
     }
-    std::vector<int> caminho = {atual->id};
-    while (atual != v)
+    std::vector<int> caminho; // ids do destino até a origem
+    for (int i = indicesCaminho.size() - 1; i >= 0; i--)
     {
-        atual = predecessores[atual];
-        caminho.push_back(atual->id);
+        caminho.push_back(csr.ids[indicesCaminho[i]]);
     }
     Grafo *grafoCaminho = new Grafo(direcionado, 0, 0);
     for (int i = caminho.size() - 1; i > 0; i--)
     {
         grafoCaminho->adicionaAresta(caminho[i], caminho[i - 1]);
     }
-    std::cout << "Caminho mínimo entre " << idOrigem << " e " << idDestino << " com custo " << distancias[getVertice(idDestino)] << ":\n";
+    std::cout << "Caminho mínimo entre " << idOrigem << " e " << idDestino << " com custo " << custoCaminho << ":\n";
     for (int i = caminho.size() - 1; i > 0; i--)
     {
         std::cout << caminho[i] << " -> ";
@@ -1087,6 +1267,94 @@ Grafo *Grafo::caminhoMinimoDijkstra(int idOrigem, int idDestino)
     return grafoCaminho;
 }
 
+/**
+ * Escolhe 'quantidade' marcos e calcula suas tabelas de distâncias, utilizadas pelas consultas de caminho mínimo
+ * ponto a ponto (ALT) enquanto o grafo não for modificado. Retorna o número de marcos preparados, ou -1 caso o grafo
+ * não seja ponderado nas arestas ou possua arcos negativos (nesses casos as tabelas não se aplicam).
+ */
+int Grafo::preparaMarcos(int quantidade)
+{
+    const GrafoCSR &csr = getCSR();
+    if (!arestasPonderadas || possuiPesosNegativos())
+    {
+        return -1;
+    }
+    CaminhoBidirecional::escolheMarcos(csr, getCSRReverso(), quantidade, marcos);
+    versaoMarcos = versao;
+    return marcos.quantidade();
+}
+
+/**
+ * Grava as tabelas de marcos no arquivo indicado. Retorna false caso não haja marcos válidos para a versão atual do
+ * grafo ou a escrita falhe.
+ */
+bool Grafo::salvaMarcos(const std::string &caminho)
+{
+    if (versaoMarcos != versao)
+    {
+        return false;
+    }
+    return CaminhoBidirecional::salvaMarcos(marcos, getCSR(), caminho);
+}
+
+/**
+ * Carrega tabelas de marcos gravadas anteriormente para este mesmo grafo. Retorna false caso o arquivo seja
+ * inválido, corresponda a outro grafo ou o grafo possua arcos negativos.
+ */
+bool Grafo::carregaMarcos(const std::string &caminho)
+{
+    if (!arestasPonderadas || possuiPesosNegativos() || !CaminhoBidirecional::carregaMarcos(caminho, getCSR(), marcos))
+    {
+        return false;
+    }
+    versaoMarcos = versao;
+    return true;
+}
+
+/**
+ * Constrói a hierarquia de contração do grafo, utilizada pelas consultas de caminho mínimo ponto a ponto enquanto o
+ * grafo não for modificado. Retorna false caso o grafo não seja ponderado nas arestas ou possua arcos negativos.
+ */
+bool Grafo::preparaHierarquia()
+{
+    const GrafoCSR &csr = getCSR();
+    if (!arestasPonderadas || possuiPesosNegativos())
+    {
+        return false;
+    }
+    HierarquiaContracao::constroi(csr, hierarquia);
+    versaoHierarquia = versao;
+    return true;
+}
+
+/**
+ * Grava a hierarquia de contração no arquivo indicado. Retorna false caso não haja hierarquia válida para a versão
+ * atual do grafo ou a escrita falhe.
+ */
+bool Grafo::salvaHierarquia(const std::string &caminho)
+{
+    if (versaoHierarquia != versao)
+    {
+        return false;
+    }
+    return HierarquiaContracao::salva(hierarquia, getCSR(), caminho);
+}
+
+/**
+ * Carrega uma hierarquia de contração gravada anteriormente para este mesmo grafo. Retorna false caso o arquivo seja
+ * inválido, corresponda a outro grafo ou o grafo possua arcos negativos.
+ */
+bool Grafo::carregaHierarquia(const std::string &caminho)
+{
+    const GrafoCSR &csr = getCSR();
+    if (!arestasPonderadas || possuiPesosNegativos() || !HierarquiaContracao::carrega(caminho, csr, hierarquia))
+    {
+        return false;
+    }
+    versaoHierarquia = versao;
+    return true;
+}
+
 /**
  * Retorna o subgrafo vértice-induzido pelo 'subconjunto' de vértices.
  * - Caso algum dos vértices não exista no grafo, retorna nullptr.
@@ -1142,7 +1410,7 @@ void Grafo::unir(int subset[], int v1, int v2)
 
 /**
  * Retorna a árvore geradora mínima do subgrafo induzido pelo conjunto de
- * vértices 'listavertice' utilizando o algoritmo de Prim.
+ * vértices 'subconjunto' utilizando o algoritmo de Prim.
  * - Caso o grafo não seja ponderado nas arestas, retorna um nullptr.
  * - Caso o subgrafo não possa existir, retorna um nullptr.
  * - Caso o subgrafo não seja conexo, retorna um nullptr.
@@ -1160,79 +1428,46 @@ Grafo *Grafo::arvoreGeradoraMinimaPrim(std::vector<int> &subconjunto)
         std::cout << "O subgrafo vértice-induzido não existe" << std::endl;
         return nullptr;
     }
-    if (subgrafo->getComponentesConexas().size() > 1)
+    GrafoCSR csr = subgrafo->congelar();
+    delete subgrafo;
+    if (!ComponentesConexas::conexo(csr, threads))
     {
         std::cout << "O subgrafo vértice-induzido não é conexo" << std::endl;
         return nullptr;
     }
-    int n = subconjunto.size();
-    int prox[n];
-    std::vector<std::vector<int>> solucao;
-    int menorId;
-    int menorpeso = INF;
-    int u;
-    int v;
-    for (int i = 0; i < n; i++)
-    {
-        Vertice *a = getVertice(subconjunto[i]);
-        Aresta *e = a->arestas;
-        while (e != nullptr)
-        {
-            if (e->peso <= menorpeso)
-            {
-                menorpeso = e->peso;
-                menorId = a->id;
-                u = a->id;
-                v = e->destino->id;
-            }
-            e = e->prox;
-        }
-    }
-    std::vector<int> aux = {u, v};
+    int n = csr.ordem();
+    std::vector<int> menorCusto(n, INF); // custo da aresta mais leve que liga cada vértice à árvore
+    std::vector<int> prox(n, -1);        // extremidade na árvore da aresta mais leve de cada vértice
+    std::vector<bool> naArvore(n, false);
     Grafo *arvore = new Grafo(direcionado, arestasPonderadas, verticesPonderados);
-    solucao.push_back(aux);
-    arvore->adicionaAresta(u, v);
-    for (int i = 1; i <= n; i++)
+    if (n > 0)
     {
-        if (custo(i, u) < custo(i, v))
-        {
-            prox[i - 1] = u;
-        }
-        else
-        {
-            prox[i - 1] = v;
-        }
+        menorCusto[0] = 0;
     }
-    prox[u - 1] = 0;
-    prox[v - 1] = 0;
-    int cont = 0;
-    int j = 1;
-    while (cont < n - 2)
+    for (int iteracao = 0; iteracao < n; iteracao++)
     {
-        int menor2 = INF;
-        for (int i = 1; i <= n; i++)
+        int j = -1;
+        for (int i = 0; i < n; i++)
         {
-            if (prox[i - 1] != 0)
+            if (!naArvore[i] && (j == -1 || menorCusto[i] < menorCusto[j]))
             {
-                if (custo(i, prox[i - 1]) < menor2)
-                {
-                    menor2 = custo(i, prox[i - 1]);
-                    j = i;
-                }
+                j = i;
             }
         }
-        aux = {j, prox[j - 1]};
-        solucao.push_back(aux);
-        arvore->adicionaAresta(j, prox[j - 1]);
-        prox[j - 1] = 0;
-        for (int i = 0; i < n; i++)
+        naArvore[j] = true;
+        if (prox[j] != -1)
+        {
+            arvore->adicionaAresta(csr.ids[prox[j]], csr.ids[j], menorCusto[j]);
+        }
+        for (int k = csr.inicio[j]; k < csr.inicio[j + 1]; k++)
         {
-            if (prox[i] != 0 && custo(i + 1, prox[i]) > custo(i + 1, j))
+            int v = csr.destinos[k];
+            if (!naArvore[v] && csr.pesos[k] < menorCusto[v])
             {
-                prox[i] = j;
+                menorCusto[v] = csr.pesos[k];
+                prox[v] = j;
             }
         }
-        cont = cont + 1;
     }
     return arvore;
 }
@@ -1257,66 +1492,37 @@ Grafo *Grafo::arvoreGeradoraMinimaKruskal(std::vector<int> &subconjunto)
         std::cout << "O subgrafo vértice-induzido não existe" << std::endl;
         return nullptr;
     }
-    if (subgrafo->getComponentesConexas().size() > 1)
+    GrafoCSR csr = subgrafo->congelar();
+    delete subgrafo;
+    if (!ComponentesConexas::conexo(csr, threads))
     {
         std::cout << "O subgrafo vértice-induzido não é conexo" << std::endl;
         return nullptr;
     }
-    int n = subconjunto.size();
-    std::vector<std::vector<int>> listaAresta;
-    std::vector<std::vector<int>> solucao;
-    std::vector<int> aux;
-    int u;
-    int v;
-    for (int i = 0; i < n; i++)
-    {
-        Vertice *a = getVertice(subconjunto[i]);
-        Aresta *e = a->arestas;
-        while (e != nullptr)
-        {
-            if (a->id < e->destino->id)
-            {
-                u = a->id;
-                v = e->destino->id;
-                aux = {u, v};
-                listaAresta.push_back(aux);
-            }
-            e = e->prox;
-        }
-    }
-    int temp1 = 0;
-    int temp2 = 0;
-    int numeroDeArestas = listaAresta.size();
-    for (int i = numeroDeArestas - 1; i > 1; i--)
+    int n = csr.ordem();
+    std::vector<int> listaArestas; // índices dos arcos do CSR, um por aresta
+    for (int k = 0; k < csr.numeroArcos(); k++)
     {
-        for (int j = 0; j < i; j++)
+        if (csr.origens[k] < csr.destinos[k])
         {
-            temp1 = listaAresta[j][0];
-            temp2 = listaAresta[j][1];
-            if (custo(listaAresta[j][0], listaAresta[j][1]) > custo(listaAresta[j + 1][0], listaAresta[j + 1][1]))
-            {
-                listaAresta[j][0] = listaAresta[j + 1][0];
-                listaAresta[j][1] = listaAresta[j + 1][1];
-                listaAresta[j + 1][0] = temp1;
-                listaAresta[j + 1][1] = temp2;
-            }
+            listaArestas.push_back(k);
         }
     }
+    std::stable_sort(listaArestas.begin(), listaArestas.end(), [&csr](int a, int b)
+                     { return csr.pesos[a] < csr.pesos[b]; });
     Grafo *arvore = new Grafo(direcionado, arestasPonderadas, verticesPonderados);
     int *subset = new int[n + 1];
     memset(subset, -1, sizeof(int) * (n + 1));
-    for (int i = 0; i < numeroDeArestas; i++)
+    for (int k : listaArestas)
     {
-        int v1 = buscar(subset, listaAresta[i][0]);
-        int v2 = buscar(subset, listaAresta[i][1]);
-        if (v1 != v2)
+        int u = csr.origens[k];
+        int v = csr.destinos[k];
+        if (buscar(subset, u) != buscar(subset, v))
         {
-            aux = {v1, v2};
-            solucao.push_back(aux);
-            unir(subset, v1, v2);
-            arvore->adicionaAresta(v1, v2);
+            unir(subset, u, v);
+            arvore->adicionaAresta(csr.ids[u], csr.ids[v], csr.pesos[k]);
         }
     }
     delete[] subset;
     return arvore;
-}
\ No newline at end of file
+}
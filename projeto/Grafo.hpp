@@ -6,6 +6,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <unordered_map>
 #include <string.h>
 #include <string>
 #include <sstream>
@@ -14,59 +15,133 @@
 #include "Aresta.hpp"
 #include "Vertice.hpp"
 #include "Printer.hpp"
+#include "GrafoCSR.hpp"
+#include "Arena.hpp"
+#include "CaminhoMinimo.hpp"
+#include "Floyd.hpp"
+#include "TodosPares.hpp"
+#include "Excentricidade.hpp"
+#include "BuscaLargura.hpp"
+#include "DeltaStepping.hpp"
+#include "CaminhoBidirecional.hpp"
+#include "HierarquiaContracao.hpp"
+#include "Biconexas.hpp"
+#include "ComponentesConexas.hpp"
+#include "ComponentesFortes.hpp"
+#include "FechoTransitivo.hpp"
+#include "IndiceAlcance.hpp"
+#include "BuscaProfundidade.hpp"
+
+/**
+ * Tripla (u, v, peso) utilizada na inserção de arestas em lote.
+ */
+struct ArestaLote
+{
+    int idOrigem;
+    int idDestino;
+    int peso;
+};
 
 class Grafo
 {
 
 public:
-    Grafo(std::ifstream &arquivoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados);
     Grafo(bool direcionado, bool arestasPonderadas, bool verticesPonderados);
+    Grafo(GrafoCSR csr);
     ~Grafo();
     std::vector<Vertice *> vertices;
     void print();
     void print(std::ofstream &output);
+    void printCaminhamento(const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &output);
+    void printMemoria();
+    void setThreads(int threads);
+    void setLarguraBalde(int larguraBalde);
+    void setIndiceEntradas(bool ativo);
     bool adicionaVertice(int idVertice, int peso = 0);
     Vertice *getVertice(int id);
     bool removeVertice(int idVertice);
     bool adicionaAresta(int idVerticeU, int idVerticeV, int peso = 0);
+    int adicionaArestas(const std::vector<ArestaLote> &lote);
     bool removeAresta(int idVerticeU, int idVerticeV);
+    int grauEntrada(int idVertice);
     Grafo *fechoTransitivoDireto(int idVertice);
     Grafo *fechoTransitivoIndireto(int idVertice);
     Grafo *caminhoMinimoFloyd(int idVerticeU, int idVerticeV);
     void analiseExcentricidade();
     Grafo *verticesDeArticulacao();
-    Grafo *caminhamentoProfundidade(int idVerticeInicio);
+    Grafo *componentesFortementeConexas();
+    long long fechoTransitivoCompleto();
+    bool alcanca(int idVerticeU, int idVerticeV);
+    bool salvaFechoTransitivo(const std::string &caminho);
+    long long preparaIndiceAlcance();
+    bool salvaIndiceAlcance(const std::string &caminho);
+    bool carregaIndiceAlcance(const std::string &caminho);
+    bool caminhamentoProfundidade(int idVerticeInicio, BuscaProfundidade::Caminhamento &caminhamento);
     Grafo *arvoreGeradoraMinimaPrim(std::vector<int> &subconjunto);
     int buscar(int subset[], int i);
     void unir(int subset[], int v1, int v2);
     Grafo *arvoreGeradoraMinimaKruskal(std::vector<int> &subconjunto);
     Grafo *caminhoMinimoDijkstra(int idOrigem, int idDestino);
+    int preparaMarcos(int quantidade);
+    bool salvaMarcos(const std::string &caminho);
+    bool carregaMarcos(const std::string &caminho);
+    bool preparaHierarquia();
+    bool salvaHierarquia(const std::string &caminho);
+    bool carregaHierarquia(const std::string &caminho);
+    GrafoCSR congelar();
+    long getVersao() const;
 
 private:
     bool direcionado;
     bool verticesPonderados;
     bool arestasPonderadas;
+    int threads = 0; // threads utilizadas pelos algoritmos paralelos (0 utiliza o número de núcleos da máquina)
+    int larguraBalde = 0; // largura dos baldes do delta-stepping (0 escolhe automaticamente)
+    long versao = 0; // incrementada a cada modificação dos vértices ou das arestas
+    bool indiceEntradas = false; // mantém em cada vértice a lista dos arcos que chegam a ele
+    // resultados memorizados, válidos enquanto a versão em que foram calculados for igual à versão atual
+    GrafoCSR csrMemorizado;
+    long versaoCSR = -1;
+    GrafoCSR csrReversoMemorizado;
+    long versaoCSRReverso = -1;
+    bool pesosNegativos = false;
+    long versaoPesosNegativos = -1;
+    CaminhoBidirecional::Marcos marcos; // tabelas ALT, preparadas sob demanda por preparaMarcos ou carregaMarcos
+    long versaoMarcos = -1;
+    HierarquiaContracao::Hierarquia hierarquia; // índice de hierarquia de contração, preparado sob demanda
+    long versaoHierarquia = -1;
+    Floyd::MatrizQuadrada distanciasFloyd;
+    Floyd::MatrizQuadrada proximosFloyd;
+    long versaoFloyd = -1;
+    Excentricidade::Extremos extremosMemorizados;
+    long versaoExtremos = -1;
+    ComponentesFortes::Condensacao condensacaoMemorizada;
+    long versaoCondensacao = -1;
+    FechoTransitivo::MatrizAlcance fechoMemorizado;
+    long versaoFecho = -1;
+    IndiceAlcance::Indice indiceAlcance; // mantido também nas inserções de arestas que não fundem componentes
+    long versaoAlcance = -1;
+    std::unordered_map<int, int> indices; // id do vértice -> posição no vetor de vértices
+    Arena<Vertice> arenaVertices;
+    Arena<Aresta> arenaArestas;
     void adicionaAdjacencias(int idA, int idB, int peso = 0);
+    void anexaAdjacencia(std::vector<Aresta *> &caudas, int u, int v, int peso);
+    void ligaEntrada(Aresta *aresta);
+    void desligaEntrada(Aresta *aresta);
+    long long chaveAresta(int u, int v);
     bool existeAresta(int idVerticeU, int idVerticeV);
-    void auxFechoDireto(Vertice *vertice, std::set<int> &fecho, Grafo *grafoFecho);
     int encontraIndiceVertice(int id);
-    void inicializaMatrizDistancias(std::vector<std::vector<int>> &distancias, int ordem);
-    void atualizaMatrizDistancias(std::vector<std::vector<int>> &distancias, int ordem, int indice);
-    std::vector<std::vector<int>> getMatrizDistancias();
-    void inicializaMatrizesFloyd(std::vector<std::vector<int>> &distancias, std::vector<std::vector<int>> &proximos, int ordem);
-    void atualizaMatrizesFloyd(std::vector<std::vector<int>> &distancias, std::vector<std::vector<int>> &proximos, int ordem, int indice);
-    bool auxFechoIndireto(std::set<int> &fecho, std::vector<Vertice *> &naoUtilizados, Grafo *grafoFecho);
+    const GrafoCSR &getCSR();
+    const GrafoCSR &getCSRReverso();
+    bool possuiPesosNegativos();
+    const ComponentesFortes::Condensacao &getCondensacao();
+    const FechoTransitivo::MatrizAlcance &getFechoTransitivo();
+    const IndiceAlcance::Indice &getIndiceAlcance();
+    bool insereArcoAlcance(int u, int v);
+    int buscaCaminhoMinimo(const GrafoCSR &csr, int origem, int destino, std::vector<int> &caminho);
     void liberaMemoriaArestas(Aresta *arestas);
-    void buscaProfundidadeComponente(Vertice *v, std::map<Vertice *, bool> &usados, std::set<Vertice *> &componente);
-    std::set<Vertice *> buscaComponente(Vertice *v, std::map<Vertice *, bool> &usados);
-    std::set<std::set<Vertice *>> getComponentesConexas();
-    void buscaProfundidadeArticulacoes(std::set<int> &articulacoes, Vertice *v, Vertice *pai, std::map<int, int> &tempoEntrada, std::map<int, int> &minimo, std::map<int, bool> visitado, int &cronometro);
-    std::set<int> encontraArticulacoesComponente(Vertice *v, std::set<Vertice *> componente);
-    int getExcentricidade(const std::vector<int> &distanciasVertice);
-    void caminhaProfundidade(Vertice *u, std::map<Vertice *, int> &cor, Grafo *arvoreProfundidade);
     int custo(int idVerticeU, int idVerticeV);
     Grafo *subgrafoInduzidoVertices(std::vector<int> &subconjunto);
-    bool existeVerticeAberto(std::map<Vertice *, bool> &abertos);
 };
 
 #endif
\ No newline at end of file
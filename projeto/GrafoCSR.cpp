@@ -0,0 +1,65 @@
+#include "GrafoCSR.hpp"
+
+int GrafoCSR::ordem() const
+{
+    return ids.size();
+}
+
+int GrafoCSR::numeroArcos() const
+{
+    return destinos.size();
+}
+
+int GrafoCSR::grau(int i) const
+{
+    return inicio[i + 1] - inicio[i];
+}
+
+/**
+ * Retorna o índice denso do vértice com o id especificado ou -1 caso ele não exista.
+ */
+int GrafoCSR::indice(int id) const
+{
+    std::unordered_map<int, int>::const_iterator it = indices.find(id);
+    if (it == indices.end())
+    {
+        return -1;
+    }
+    return it->second;
+}
+
+/**
+ * Retorna a fotografia com todos os arcos invertidos (os arcos de saída de cada vértice passam a ser os de entrada),
+ * montada por contagem dos graus de entrada. Os arcos que chegam a cada vértice ficam na ordem de suas origens.
+ */
+GrafoCSR GrafoCSR::transposta() const
+{
+    GrafoCSR reverso;
+    reverso.direcionado = direcionado;
+    reverso.arestasPonderadas = arestasPonderadas;
+    reverso.verticesPonderados = verticesPonderados;
+    reverso.ids = ids;
+    reverso.pesosVertices = pesosVertices;
+    reverso.indices = indices;
+    reverso.inicio.assign(ordem() + 1, 0);
+    for (int destino : destinos)
+    {
+        reverso.inicio[destino + 1]++;
+    }
+    for (int i = 0; i < ordem(); i++)
+    {
+        reverso.inicio[i + 1] += reverso.inicio[i];
+    }
+    reverso.origens.resize(numeroArcos());
+    reverso.destinos.resize(numeroArcos());
+    reverso.pesos.resize(numeroArcos());
+    std::vector<int> posicoes(reverso.inicio.begin(), reverso.inicio.end() - 1);
+    for (int k = 0; k < numeroArcos(); k++)
+    {
+        int posicao = posicoes[destinos[k]]++;
+        reverso.origens[posicao] = destinos[k];
+        reverso.destinos[posicao] = origens[k];
+        reverso.pesos[posicao] = pesos[k];
+    }
+    return reverso;
+}
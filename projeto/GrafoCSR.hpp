@@ -0,0 +1,33 @@
+#ifndef GRAFO_CSR_HPP
+#define GRAFO_CSR_HPP
+
+#include <vector>
+#include <unordered_map>
+
+/**
+ * Fotografia imutável de um Grafo no formato CSR (compressed sparse row), obtida através de Grafo::congelar().
+ * Os vértices são identificados por índices densos 0..ordem-1, na mesma ordem do vetor Grafo::vertices, e os
+ * arcos que partem do vértice de índice i ocupam as posições [inicio[i], inicio[i + 1]) dos vetores
+ * origens, destinos e pesos. Em grafos não-direcionados cada aresta aparece uma vez em cada sentido.
+ */
+struct GrafoCSR
+{
+    bool direcionado;
+    bool arestasPonderadas;
+    bool verticesPonderados;
+    std::vector<int> ids;           // id original de cada vértice
+    std::vector<int> pesosVertices; // peso de cada vértice
+    std::vector<int> inicio;        // deslocamentos das adjacências, com ordem + 1 posições
+    std::vector<int> origens;       // índice denso da origem de cada arco
+    std::vector<int> destinos;      // índice denso do destino de cada arco
+    std::vector<int> pesos;         // peso de cada arco
+    std::unordered_map<int, int> indices;
+
+    int ordem() const;
+    int numeroArcos() const;
+    int grau(int i) const;
+    int indice(int id) const;
+    GrafoCSR transposta() const;
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef HEAP_INDEXADO_HPP
+#define HEAP_INDEXADO_HPP
+
+#include <vector>
+
+/**
+ * Heap binário de mínimo sobre índices densos de vértices (0..n-1), com chaves inteiras.
+ * Guarda a posição de cada vértice dentro do heap, o que permite diminuir a chave de um vértice
+ * já inserido em O(log n) sem inserir cópias. O heap é reutilizável: limpa() só desfaz as posições
+ * dos vértices que ainda estavam nele, sem percorrer os n vértices.
+ */
+class HeapIndexado
+{
+public:
+    void redimensiona(int n)
+    {
+        if ((int)posicoes.size() < n)
+        {
+            posicoes.resize(n, -1);
+        }
+    }
+
+    bool vazio() const { return itens.empty(); }
+    bool contem(int vertice) const { return posicoes[vertice] != -1; }
+    int chaveMinima() const { return itens[0].chave; }
+
+    /**
+     * Insere o vértice com a chave informada ou, se ele já estiver no heap, diminui sua chave.
+     */
+    void insereOuDiminui(int vertice, int chave)
+    {
+        int posicao = posicoes[vertice];
+        if (posicao == -1)
+        {
+            posicao = itens.size();
+            itens.push_back({chave, vertice});
+            posicoes[vertice] = posicao;
+        }
+        else
+        {
+            itens[posicao].chave = chave;
+        }
+        sobe(posicao);
+    }
+
+    int removeMinimo()
+    {
+        int vertice = itens[0].vertice;
+        posicoes[vertice] = -1;
+        Item ultimo = itens.back();
+        itens.pop_back();
+        if (!itens.empty())
+        {
+            itens[0] = ultimo;
+            posicoes[ultimo.vertice] = 0;
+            desce(0);
+        }
+        return vertice;
+    }
+
+    void limpa()
+    {
+        for (const Item &item : itens)
+        {
+            posicoes[item.vertice] = -1;
+        }
+        itens.clear();
+    }
+
+private:
+    struct Item
+    {
+        int chave;
+        int vertice;
+    };
+    std::vector<Item> itens;
+    std::vector<int> posicoes; // posição de cada vértice em itens, ou -1 se ele não está no heap
+
+    void sobe(int posicao)
+    {
+        Item item = itens[posicao];
+        while (posicao > 0)
+        {
+            int pai = (posicao - 1) / 2;
+            if (itens[pai].chave <= item.chave)
+            {
+                break;
+            }
+            itens[posicao] = itens[pai];
+            posicoes[itens[posicao].vertice] = posicao;
+            posicao = pai;
+        }
+        itens[posicao] = item;
+        posicoes[item.vertice] = posicao;
+    }
+
+    void desce(int posicao)
+    {
+        Item item = itens[posicao];
+        int tamanho = itens.size();
+        while (true)
+        {
+            int filho = 2 * posicao + 1;
+            if (filho >= tamanho)
+            {
+                break;
+            }
+            if (filho + 1 < tamanho && itens[filho + 1].chave < itens[filho].chave)
+            {
+                filho++;
+            }
+            if (itens[filho].chave >= item.chave)
+            {
+                break;
+            }
+            itens[posicao] = itens[filho];
+            posicoes[itens[posicao].vertice] = posicao;
+            posicao = filho;
+        }
+        itens[posicao] = item;
+        posicoes[item.vertice] = posicao;
+    }
+};
+
+#endif
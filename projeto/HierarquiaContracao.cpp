@@ -0,0 +1,485 @@
+#include "HierarquiaContracao.hpp"
+#include "CaminhoBidirecional.hpp"
+#include "CacheBinario.hpp"
+#include "ArquivoMapeado.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <fstream>
+#include <queue>
+#include <functional>
+
+const char ASSINATURA_HIERARQUIA[8] = {'H', 'I', 'E', 'R', 'A', 'R', 'Q', 'C'};
+const int32_t VERSAO_HIERARQUIA = 2;
+
+/**
+ * Insere o arco origem -> destino no grafo residual ou, se ele já existir, mantém apenas o de menor peso.
+ */
+void HierarquiaContracao::adicionaArco(Contracao &contracao, int origem, int destino, int peso, int meio)
+{
+    for (Arco &arco : contracao.saidas[origem])
+    {
+        if (arco.vizinho == destino)
+        {
+            if (peso < arco.peso)
+            {
+                arco.peso = peso;
+                arco.meio = meio;
+                for (Arco &reverso : contracao.entradas[destino])
+                {
+                    if (reverso.vizinho == origem)
+                    {
+                        reverso.peso = peso;
+                        reverso.meio = meio;
+                        break;
+                    }
+                }
+            }
+            return;
+        }
+    }
+    contracao.saidas[origem].push_back({destino, peso, meio});
+    contracao.entradas[destino].push_back({origem, peso, meio});
+}
+
+/**
+ * Dijkstra local no grafo residual a partir de 'origem', sem passar por 'ignorado', limitado às distâncias até
+ * 'limite' e a LIMITE_TESTEMUNHA vértices fechados; termina antes se os 'alvos' vértices marcados com a rodada
+ * corrente forem todos fechados. As distâncias obtidas são limites superiores das reais.
+ */
+void HierarquiaContracao::buscaTestemunhas(Contracao &contracao, int origem, int ignorado, long limite, int alvos)
+{
+    CaminhoMinimo::EspacoDijkstra &espaco = contracao.espaco;
+    espaco.prepara(contracao.saidas.size());
+    espaco.geracoes[origem] = espaco.geracaoAtual;
+    espaco.distancias[origem] = 0;
+    espaco.heap.insereOuDiminui(origem, 0);
+    int fechados = 0;
+    while (!espaco.heap.vazio() && espaco.heap.chaveMinima() <= limite && fechados < LIMITE_TESTEMUNHA)
+    {
+        int distanciaAtual = espaco.heap.chaveMinima();
+        int atual = espaco.heap.removeMinimo();
+        fechados++;
+        if (contracao.alvos[atual] == contracao.rodada && --alvos == 0)
+        {
+            break;
+        }
+        for (const Arco &arco : contracao.saidas[atual])
+        {
+            int vizinho = arco.vizinho;
+            int distancia = distanciaAtual + arco.peso;
+            if (vizinho != ignorado && distancia < espaco.distancia(vizinho))
+            {
+                espaco.geracoes[vizinho] = espaco.geracaoAtual;
+                espaco.distancias[vizinho] = distancia;
+                espaco.heap.insereOuDiminui(vizinho, distancia);
+            }
+        }
+    }
+}
+
+/**
+ * Conta os atalhos que a contração de v exigiria (e, se 'atalhos' não for nullptr, os registra): para cada par
+ * u -> v -> w, o atalho é necessário se a busca de testemunhas a partir de u não encontrar caminho tão curto sem v.
+ */
+int HierarquiaContracao::simula(Contracao &contracao, int v, std::vector<Atalho> *atalhos)
+{
+    int necessarios = 0;
+    for (const Arco &entrada : contracao.entradas[v])
+    {
+        int u = entrada.vizinho;
+        int maiorSaida = -1;
+        int alvos = 0;
+        contracao.rodada++;
+        for (const Arco &saida : contracao.saidas[v])
+        {
+            if (saida.vizinho != u)
+            {
+                maiorSaida = std::max(maiorSaida, saida.peso);
+                contracao.alvos[saida.vizinho] = contracao.rodada;
+                alvos++;
+            }
+        }
+        if (maiorSaida == -1)
+        {
+            continue;
+        }
+        buscaTestemunhas(contracao, u, v, (long)entrada.peso + maiorSaida, alvos);
+        for (const Arco &saida : contracao.saidas[v])
+        {
+            int pesoAtalho = entrada.peso + saida.peso;
+            if (saida.vizinho != u && contracao.espaco.distancia(saida.vizinho) > pesoAtalho)
+            {
+                necessarios++;
+                if (atalhos != nullptr)
+                {
+                    atalhos->push_back({u, saida.vizinho, pesoAtalho});
+                }
+            }
+        }
+    }
+    return necessarios;
+}
+
+/**
+ * Retira v do grafo residual: seus arcos passam para o índice (todos os vizinhos restantes terão nível maior)
+ * e os atalhos calculados por simula são inseridos entre os vizinhos.
+ */
+void HierarquiaContracao::contrai(Contracao &contracao, int v, std::vector<Atalho> &atalhos)
+{
+    auto removeArco = [](std::vector<Arco> &arcos, int vizinho)
+    {
+        arcos.erase(std::remove_if(arcos.begin(), arcos.end(), [vizinho](const Arco &arco) { return arco.vizinho == vizinho; }), arcos.end());
+    };
+    for (const Arco &saida : contracao.saidas[v])
+    {
+        removeArco(contracao.entradas[saida.vizinho], v);
+        contracao.vizinhosContraidos[saida.vizinho]++;
+    }
+    for (const Arco &entrada : contracao.entradas[v])
+    {
+        removeArco(contracao.saidas[entrada.vizinho], v);
+        contracao.vizinhosContraidos[entrada.vizinho]++;
+    }
+    contracao.subida[v] = std::move(contracao.saidas[v]);
+    contracao.descida[v] = std::move(contracao.entradas[v]);
+    contracao.saidas[v] = std::vector<Arco>();
+    contracao.entradas[v] = std::vector<Arco>();
+    for (const Atalho &atalho : atalhos)
+    {
+        adicionaArco(contracao, atalho.origem, atalho.destino, atalho.peso, v);
+    }
+}
+
+void HierarquiaContracao::compacta(const std::vector<std::vector<Arco>> &listas, std::vector<int> &inicio, std::vector<int> &destinos,
+                                   std::vector<int> &pesos, std::vector<int> &meios)
+{
+    inicio.assign(listas.size() + 1, 0);
+    for (size_t v = 0; v < listas.size(); v++)
+    {
+        inicio[v + 1] = inicio[v] + listas[v].size();
+    }
+    destinos.resize(inicio.back());
+    pesos.resize(inicio.back());
+    meios.resize(inicio.back());
+    for (size_t v = 0; v < listas.size(); v++)
+    {
+        int posicao = inicio[v];
+        for (const Arco &arco : listas[v])
+        {
+            destinos[posicao] = arco.vizinho;
+            pesos[posicao] = arco.peso;
+            meios[posicao] = arco.meio;
+            posicao++;
+        }
+    }
+}
+
+/**
+ * Constrói a hierarquia de contração do grafo. Os vértices são contraídos em ordem crescente de prioridade
+ * (diferença de arestas mais vizinhos contraídos), reavaliada de forma preguiçosa ao sair da fila e recalculada
+ * para os vizinhos de cada vértice contraído.
+ * Obs.: o grafo não pode possuir arcos de peso negativo.
+ */
+void HierarquiaContracao::constroi(const GrafoCSR &csr, Hierarquia &hierarquia)
+{
+    int ordem = csr.ordem();
+    Contracao contracao;
+    contracao.saidas.resize(ordem);
+    contracao.entradas.resize(ordem);
+    contracao.vizinhosContraidos.assign(ordem, 0);
+    contracao.alvos.assign(ordem, 0);
+    contracao.subida.resize(ordem);
+    contracao.descida.resize(ordem);
+    for (int u = 0; u < ordem; u++)
+    {
+        for (int k = csr.inicio[u]; k < csr.inicio[u + 1]; k++)
+        {
+            if (csr.destinos[k] != u)
+            {
+                adicionaArco(contracao, u, csr.destinos[k], csr.pesos[k], -1);
+            }
+        }
+    }
+    auto prioridadeDe = [&contracao](int v, int atalhos)
+    {
+        return atalhos - (int)contracao.entradas[v].size() - (int)contracao.saidas[v].size() + contracao.vizinhosContraidos[v];
+    };
+    std::vector<int> prioridades(ordem);
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<std::pair<int, int>>> fila;
+    for (int v = 0; v < ordem; v++)
+    {
+        prioridades[v] = prioridadeDe(v, simula(contracao, v, nullptr));
+        fila.push({prioridades[v], v});
+    }
+    hierarquia.direcionado = csr.direcionado;
+    hierarquia.niveis.assign(ordem, -1);
+    int nivel = 0;
+    std::vector<Atalho> atalhos;
+    std::vector<int> vizinhos;
+    while (!fila.empty())
+    {
+        std::pair<int, int> topo = fila.top();
+        fila.pop();
+        int v = topo.second;
+        if (hierarquia.niveis[v] != -1 || topo.first != prioridades[v])
+        {
+            continue; // entrada obsoleta
+        }
+        atalhos.clear();
+        int prioridade = prioridadeDe(v, simula(contracao, v, &atalhos));
+        if (prioridade > topo.first && !fila.empty() && prioridade > fila.top().first)
+        {
+            prioridades[v] = prioridade;
+            fila.push({prioridade, v});
+            continue;
+        }
+        vizinhos.clear();
+        for (const Arco &arco : contracao.saidas[v])
+        {
+            vizinhos.push_back(arco.vizinho);
+        }
+        for (const Arco &arco : contracao.entradas[v])
+        {
+            vizinhos.push_back(arco.vizinho);
+        }
+        contrai(contracao, v, atalhos);
+        hierarquia.niveis[v] = nivel++;
+        std::sort(vizinhos.begin(), vizinhos.end());
+        vizinhos.erase(std::unique(vizinhos.begin(), vizinhos.end()), vizinhos.end());
+        for (int vizinho : vizinhos)
+        {
+            prioridades[vizinho] = prioridadeDe(vizinho, simula(contracao, vizinho, nullptr));
+            fila.push({prioridades[vizinho], vizinho});
+        }
+    }
+    compacta(contracao.subida, hierarquia.inicioSubida, hierarquia.destinosSubida, hierarquia.pesosSubida, hierarquia.meiosSubida);
+    compacta(contracao.descida, hierarquia.inicioDescida, hierarquia.destinosDescida, hierarquia.pesosDescida, hierarquia.meiosDescida);
+}
+
+/**
+ * Grava o índice: cabeçalho fixo seguido dos níveis e dos vetores dos CSRs de subida e de descida, como inteiros
+ * de 32 bits na ordem de bytes da máquina. Retorna false caso a escrita falhe.
+ */
+bool HierarquiaContracao::salva(const Hierarquia &hierarquia, const GrafoCSR &csr, const std::string &caminho)
+{
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo)
+    {
+        return false;
+    }
+    Cabecalho cabecalho;
+    memset(&cabecalho, 0, sizeof(Cabecalho));
+    CacheBinario::preencheIndice(cabecalho.indice, ASSINATURA_HIERARQUIA, VERSAO_HIERARQUIA, csr);
+    cabecalho.arcosSubida = hierarquia.destinosSubida.size();
+    cabecalho.arcosDescida = hierarquia.destinosDescida.size();
+    arquivo.write(reinterpret_cast<const char *>(&cabecalho), sizeof(Cabecalho));
+    CacheBinario::escreveVetor(arquivo, hierarquia.niveis);
+    CacheBinario::escreveVetor(arquivo, hierarquia.inicioSubida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.destinosSubida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.pesosSubida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.meiosSubida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.inicioDescida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.destinosDescida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.pesosDescida);
+    CacheBinario::escreveVetor(arquivo, hierarquia.meiosDescida);
+    return (bool)arquivo;
+}
+
+/**
+ * Carrega um índice gravado por salva; 'hierarquia' só é alterada se o arquivo for válido para 'csr' e seus CSRs
+ * de subida e de descida forem consistentes.
+ */
+bool HierarquiaContracao::carrega(const std::string &caminho, const GrafoCSR &csr, Hierarquia &hierarquia)
+{
+    ArquivoMapeado arquivo(caminho);
+    Cabecalho cabecalho;
+    const char *cursor = CacheBinario::abreIndice(arquivo, ASSINATURA_HIERARQUIA, VERSAO_HIERARQUIA, csr, &cabecalho, sizeof(Cabecalho));
+    if (cursor == nullptr || cabecalho.arcosSubida < 0 || cabecalho.arcosDescida < 0)
+    {
+        return false;
+    }
+    size_t ordem = csr.ordem();
+    size_t esperado = sizeof(Cabecalho) + sizeof(int32_t) * (3 * ordem + 2 + 3 * ((size_t)cabecalho.arcosSubida + cabecalho.arcosDescida));
+    if (arquivo.tamanho() != esperado)
+    {
+        return false;
+    }
+    Hierarquia lida;
+    lida.direcionado = csr.direcionado;
+    cursor = CacheBinario::leVetor(cursor, lida.niveis, ordem);
+    cursor = CacheBinario::leVetor(cursor, lida.inicioSubida, ordem + 1);
+    cursor = CacheBinario::leVetor(cursor, lida.destinosSubida, cabecalho.arcosSubida);
+    cursor = CacheBinario::leVetor(cursor, lida.pesosSubida, cabecalho.arcosSubida);
+    cursor = CacheBinario::leVetor(cursor, lida.meiosSubida, cabecalho.arcosSubida);
+    cursor = CacheBinario::leVetor(cursor, lida.inicioDescida, ordem + 1);
+    cursor = CacheBinario::leVetor(cursor, lida.destinosDescida, cabecalho.arcosDescida);
+    cursor = CacheBinario::leVetor(cursor, lida.pesosDescida, cabecalho.arcosDescida);
+    cursor = CacheBinario::leVetor(cursor, lida.meiosDescida, cabecalho.arcosDescida);
+    auto consistente = [ordem](const std::vector<int> &inicio, const std::vector<int> &destinos, const std::vector<int> &meios)
+    {
+        if (inicio[0] != 0 || inicio[ordem] != (int)destinos.size())
+        {
+            return false;
+        }
+        for (size_t v = 0; v < ordem; v++)
+        {
+            if (inicio[v] > inicio[v + 1])
+            {
+                return false;
+            }
+        }
+        for (size_t k = 0; k < destinos.size(); k++)
+        {
+            if (destinos[k] < 0 || destinos[k] >= (int)ordem || meios[k] < -1 || meios[k] >= (int)ordem)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (!consistente(lida.inicioSubida, lida.destinosSubida, lida.meiosSubida) || !consistente(lida.inicioDescida, lida.destinosDescida, lida.meiosDescida))
+    {
+        return false;
+    }
+    hierarquia = std::move(lida);
+    return true;
+}
+
+/**
+ * Vértice contraído substituído pelo arco u -> v do índice (-1 se o arco é original). Cada par de vértices tem no
+ * máximo um arco no índice: o ascendente guardado em u ou o descendente guardado em v.
+ */
+int HierarquiaContracao::meioDoArco(const Hierarquia &hierarquia, int u, int v)
+{
+    if (hierarquia.niveis[u] < hierarquia.niveis[v])
+    {
+        for (int k = hierarquia.inicioSubida[u]; k < hierarquia.inicioSubida[u + 1]; k++)
+        {
+            if (hierarquia.destinosSubida[k] == v)
+            {
+                return hierarquia.meiosSubida[k];
+            }
+        }
+    }
+    else
+    {
+        for (int k = hierarquia.inicioDescida[v]; k < hierarquia.inicioDescida[v + 1]; k++)
+        {
+            if (hierarquia.destinosDescida[k] == u)
+            {
+                return hierarquia.meiosDescida[k];
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * Acrescenta a 'caminho' os vértices do arco u -> v do índice expandido em arcos originais, sem o próprio u.
+ * Um atalho u -> v com meio m vira u -> m -> v; a expansão usa uma pilha explícita.
+ */
+void HierarquiaContracao::desempacota(const Hierarquia &hierarquia, int u, int v, std::vector<int> &caminho)
+{
+    std::vector<std::pair<int, int>> pilha;
+    pilha.push_back({u, v});
+    while (!pilha.empty())
+    {
+        std::pair<int, int> arco = pilha.back();
+        pilha.pop_back();
+        int meio = meioDoArco(hierarquia, arco.first, arco.second);
+        if (meio == -1)
+        {
+            caminho.push_back(arco.second);
+        }
+        else
+        {
+            pilha.push_back({meio, arco.second});
+            pilha.push_back({arco.first, meio});
+        }
+    }
+}
+
+/**
+ * Caminho mínimo entre os índices densos 'origem' e 'destino': busca ascendente a partir da origem pelos arcos
+ * de subida e a partir do destino pelos arcos de descida invertidos; cada lado para quando o topo do seu heap
+ * alcança o melhor encontro. Preenche 'caminho' com os índices da origem ao destino, já sem atalhos, e retorna
+ * o custo, ou INFINITO se não houver caminho.
+ */
+int HierarquiaContracao::busca(const Hierarquia &hierarquia, int origem, int destino, std::vector<int> &caminho)
+{
+    const int INFINITO = CaminhoMinimo::INFINITO;
+    caminho.clear();
+    if (origem == destino)
+    {
+        caminho.push_back(origem);
+        return 0;
+    }
+    CaminhoBidirecional::EspacoBidirecional &espaco = CaminhoBidirecional::getEspacoThread();
+    CaminhoMinimo::EspacoDijkstra *lados[2] = {&espaco.frente, &espaco.tras};
+    const std::vector<int> *inicios[2] = {&hierarquia.inicioSubida, &hierarquia.inicioDescida};
+    const std::vector<int> *destinos[2] = {&hierarquia.destinosSubida, &hierarquia.destinosDescida};
+    const std::vector<int> *pesos[2] = {&hierarquia.pesosSubida, &hierarquia.pesosDescida};
+    int raizes[2] = {origem, destino};
+    for (int l = 0; l < 2; l++)
+    {
+        CaminhoMinimo::EspacoDijkstra &lado = *lados[l];
+        lado.prepara(hierarquia.ordem());
+        lado.geracoes[raizes[l]] = lado.geracaoAtual;
+        lado.distancias[raizes[l]] = 0;
+        lado.predecessores[raizes[l]] = -1;
+        lado.heap.insereOuDiminui(raizes[l], 0);
+    }
+    long melhor = LONG_MAX;
+    int encontro = -1;
+    while (!lados[0]->heap.vazio() || !lados[1]->heap.vazio())
+    {
+        int l = lados[1]->heap.vazio() || (!lados[0]->heap.vazio() && lados[0]->heap.chaveMinima() <= lados[1]->heap.chaveMinima()) ? 0 : 1;
+        CaminhoMinimo::EspacoDijkstra &lado = *lados[l];
+        const CaminhoMinimo::EspacoDijkstra &outroLado = *lados[1 - l];
+        if (lado.heap.chaveMinima() >= melhor)
+        {
+            lado.heap.limpa(); // nenhum vértice restante deste lado melhora o encontro
+            continue;
+        }
+        int distanciaU = lado.heap.chaveMinima();
+        int u = lado.heap.removeMinimo();
+        for (int k = (*inicios[l])[u]; k < (*inicios[l])[u + 1]; k++)
+        {
+            int v = (*destinos[l])[k];
+            int distancia = distanciaU + (*pesos[l])[k];
+            if (distancia < lado.distancia(v))
+            {
+                lado.geracoes[v] = lado.geracaoAtual;
+                lado.distancias[v] = distancia;
+                lado.predecessores[v] = u;
+                lado.heap.insereOuDiminui(v, distancia);
+                if (outroLado.alcancado(v) && (long)distancia + outroLado.distancias[v] < melhor)
+                {
+                    melhor = (long)distancia + outroLado.distancias[v];
+                    encontro = v;
+                }
+            }
+        }
+    }
+    if (encontro == -1)
+    {
+        return INFINITO;
+    }
+    std::vector<int> subida;
+    for (int atual = encontro; atual != -1; atual = lados[0]->predecessor(atual))
+    {
+        subida.push_back(atual);
+    }
+    std::reverse(subida.begin(), subida.end());
+    caminho.push_back(origem);
+    for (size_t i = 0; i + 1 < subida.size(); i++)
+    {
+        desempacota(hierarquia, subida[i], subida[i + 1], caminho);
+    }
+    for (int atual = encontro; lados[1]->predecessor(atual) != -1; atual = lados[1]->predecessor(atual))
+    {
+        desempacota(hierarquia, atual, lados[1]->predecessor(atual), caminho);
+    }
+    return melhor;
+}
@@ -0,0 +1,93 @@
+#ifndef HIERARQUIA_CONTRACAO_HPP
+#define HIERARQUIA_CONTRACAO_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "GrafoCSR.hpp"
+#include "CaminhoMinimo.hpp"
+#include "CacheBinario.hpp"
+
+/**
+ * Hierarquia de contração (Geisberger et al.) para consultas de caminho mínimo ponto a ponto em grafos estáticos
+ * sem arcos negativos. Os vértices são contraídos um a um, na ordem dada pela diferença de arestas (atalhos
+ * necessários menos arcos removidos, mais vizinhos já contraídos); ao contrair v, cada par u -> v -> w sem
+ * caminho testemunha alternativo tão curto ganha o atalho u -> w. O índice guarda, em formato CSR, os arcos
+ * ascendentes (para vértices de nível maior) e os descendentes invertidos; uma consulta é uma busca
+ * bidirecional que só sobe na hierarquia, e os atalhos do caminho encontrado são desempacotados nos arcos originais.
+ */
+namespace HierarquiaContracao
+{
+    const int LIMITE_TESTEMUNHA = 500; // vértices fechados por busca de testemunha (atalhos a mais não afetam a correção)
+
+    struct Arco
+    {
+        int vizinho;
+        int peso;
+        int meio; // vértice contraído que o atalho substitui, ou -1 para arcos originais
+    };
+
+    /**
+     * Índice pronto para consultas. Arcos de 'subida' partem do vértice de menor nível para o de maior nível;
+     * 'descida' guarda, em cada vértice v, os arcos x -> v vindos de vértices x de nível maior, com destino x.
+     */
+    struct Hierarquia
+    {
+        bool direcionado = false;
+        std::vector<int> niveis;
+        std::vector<int> inicioSubida;
+        std::vector<int> destinosSubida;
+        std::vector<int> pesosSubida;
+        std::vector<int> meiosSubida;
+        std::vector<int> inicioDescida;
+        std::vector<int> destinosDescida;
+        std::vector<int> pesosDescida;
+        std::vector<int> meiosDescida;
+
+        int ordem() const { return niveis.size(); }
+    };
+
+    struct Cabecalho
+    {
+        CacheBinario::CabecalhoIndice indice;
+        int32_t arcosSubida;
+        int32_t arcosDescida;
+    };
+
+    struct Atalho
+    {
+        int origem;
+        int destino;
+        int peso;
+    };
+
+    /**
+     * Grafo residual (vértices ainda não contraídos) e vetores de trabalho da construção.
+     */
+    struct Contracao
+    {
+        std::vector<std::vector<Arco>> saidas;
+        std::vector<std::vector<Arco>> entradas;
+        std::vector<int> vizinhosContraidos;
+        std::vector<std::vector<Arco>> subida;
+        std::vector<std::vector<Arco>> descida;
+        std::vector<int> alvos;   // rodada de busca de testemunhas em que o vértice é alvo
+        int rodada = 0;
+        CaminhoMinimo::EspacoDijkstra espaco;
+    };
+
+    void constroi(const GrafoCSR &csr, Hierarquia &hierarquia);
+    void adicionaArco(Contracao &contracao, int origem, int destino, int peso, int meio);
+    int simula(Contracao &contracao, int v, std::vector<Atalho> *atalhos);
+    void buscaTestemunhas(Contracao &contracao, int origem, int ignorado, long limite, int alvos);
+    void contrai(Contracao &contracao, int v, std::vector<Atalho> &atalhos);
+    void compacta(const std::vector<std::vector<Arco>> &listas, std::vector<int> &inicio, std::vector<int> &destinos,
+                  std::vector<int> &pesos, std::vector<int> &meios);
+    bool salva(const Hierarquia &hierarquia, const GrafoCSR &csr, const std::string &caminho);
+    bool carrega(const std::string &caminho, const GrafoCSR &csr, Hierarquia &hierarquia);
+    int busca(const Hierarquia &hierarquia, int origem, int destino, std::vector<int> &caminho);
+    int meioDoArco(const Hierarquia &hierarquia, int u, int v);
+    void desempacota(const Hierarquia &hierarquia, int u, int v, std::vector<int> &caminho);
+}
+
+#endif
@@ -0,0 +1,443 @@
+#include "IndiceAlcance.hpp"
+#include "CacheBinario.hpp"
+#include "ArquivoMapeado.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+const char ASSINATURA_ALCANCE[8] = {'A', 'L', 'C', 'A', 'N', 'C', 'E', 'I'};
+const int32_t VERSAO_ALCANCE = 2;
+
+/**
+ * Retorna true se a componente 'origem' alcança a componente 'destino', ambas distintas.
+ */
+bool IndiceAlcance::Indice::alcancaComponente(int origem, int destino) const
+{
+    int numeroDestino = posOrdem[destino];
+    if (corteNegativo && (numeroDestino > posOrdem[origem] || numeroDestino < minimoAlcancado[origem]))
+    {
+        return false;
+    }
+    if (inicioArvore[origem] <= numeroDestino && numeroDestino <= posOrdem[origem])
+    {
+        return true; // destino é descendente da origem na floresta da busca
+    }
+    return cobre(saida[origem], entrada[destino], numero);
+}
+
+/**
+ * Retorna true se existe caminho com ao menos um arco de u até v (índices densos do grafo original).
+ * Um vértice só pertence ao próprio fecho se estiver em algum ciclo.
+ */
+bool IndiceAlcance::Indice::alcanca(int u, int v) const
+{
+    int componenteU = componentes[u];
+    int componenteV = componentes[v];
+    if (componenteU == componenteV)
+    {
+        return ciclicas[componenteU];
+    }
+    return alcancaComponente(componenteU, componenteV);
+}
+
+/**
+ * Total de rótulos guardados nas listas de saída e de entrada.
+ */
+long long IndiceAlcance::Indice::rotulos() const
+{
+    long long total = 0;
+    for (int c = 0; c < numero; c++)
+    {
+        total += saida[c].size() + entrada[c].size();
+    }
+    return total;
+}
+
+/**
+ * Retorna true se as listas ordenadas de postos possuem um centro em comum de posto até 'limite'.
+ */
+bool IndiceAlcance::cobre(const std::vector<int> &saida, const std::vector<int> &entrada, int limite)
+{
+    size_t i = 0;
+    size_t j = 0;
+    while (i < saida.size() && j < entrada.size())
+    {
+        int a = saida[i];
+        int b = entrada[j];
+        if (a > limite || b > limite)
+        {
+            return false;
+        }
+        if (a == b)
+        {
+            return true;
+        }
+        if (a < b)
+        {
+            i++;
+        }
+        else
+        {
+            j++;
+        }
+    }
+    return false;
+}
+
+/**
+ * Busca em largura a partir da componente 'inicio' que acrescenta o centro de posto 'posto' às listas de entrada
+ * das componentes alcançadas (frente) ou às listas de saída das componentes que alcançam 'inicio' (para trás).
+ * A busca é podada nas componentes cujo par com o centro já é coberto por um centro de posto menor ou igual, o que
+ * mantém a propriedade dos marcos podados: o centro mais importante entre os que ligam u a v está nos rótulos de ambos.
+ * 'marcas' deve estar zerado e é zerado novamente ao final.
+ */
+void IndiceAlcance::retomaBusca(Indice &indice, int posto, int inicio, bool frente, std::vector<char> &marcas)
+{
+    int centro = indice.centros[posto];
+    std::vector<int> fila;
+    fila.push_back(inicio);
+    marcas[inicio] = 1;
+    for (size_t k = 0; k < fila.size(); k++)
+    {
+        int w = fila[k];
+        bool coberto = frente ? cobre(indice.saida[centro], indice.entrada[w], posto) : cobre(indice.saida[w], indice.entrada[centro], posto);
+        if (coberto)
+        {
+            continue;
+        }
+        std::vector<int> &rotulos = frente ? indice.entrada[w] : indice.saida[w];
+        rotulos.insert(std::lower_bound(rotulos.begin(), rotulos.end(), posto), posto);
+        for (int x : frente ? indice.sucessores[w] : indice.antecessores[w])
+        {
+            if (!marcas[x])
+            {
+                marcas[x] = 1;
+                fila.push_back(x);
+            }
+        }
+    }
+    for (int w : fila)
+    {
+        marcas[w] = 0;
+    }
+}
+
+/**
+ * Numera as componentes na pós-ordem de uma busca em profundidade iterativa iniciada, em ordem crescente, nas
+ * componentes sem antecessores, registrando o intervalo de cada subárvore e o menor número alcançado por cada
+ * componente. Num DAG toda componente alcançada termina antes de quem a alcança, então ao terminar uma componente
+ * os mínimos de seus sucessores já estão prontos.
+ */
+void IndiceAlcance::numeraPosOrdem(Indice &indice)
+{
+    int numero = indice.numero;
+    indice.posOrdem.assign(numero, -1);
+    indice.inicioArvore.assign(numero, 0);
+    indice.minimoAlcancado.assign(numero, 0);
+    indice.corteNegativo = true;
+    std::vector<std::pair<int, int>> pilha; // (componente, próximo sucessor)
+    std::vector<char> visitada(numero, 0);
+    int contador = 0;
+    for (int raiz = 0; raiz < numero; raiz++)
+    {
+        if (!indice.antecessores[raiz].empty())
+        {
+            continue;
+        }
+        visitada[raiz] = 1;
+        indice.inicioArvore[raiz] = contador;
+        pilha.push_back({raiz, 0});
+        while (!pilha.empty())
+        {
+            int c = pilha.back().first;
+            int &proximo = pilha.back().second;
+            if (proximo < (int)indice.sucessores[c].size())
+            {
+                int s = indice.sucessores[c][proximo++];
+                if (!visitada[s])
+                {
+                    visitada[s] = 1;
+                    indice.inicioArvore[s] = contador;
+                    pilha.push_back({s, 0});
+                }
+                continue;
+            }
+            indice.posOrdem[c] = contador++;
+            int minimo = indice.posOrdem[c];
+            for (int s : indice.sucessores[c])
+            {
+                minimo = std::min(minimo, indice.minimoAlcancado[s]);
+            }
+            indice.minimoAlcancado[c] = minimo;
+            pilha.pop_back();
+        }
+    }
+}
+
+/**
+ * Constrói o índice a partir da condensação: adjacências do DAG, pós-ordem e rótulos. Os centros são processados
+ * em ordem decrescente de (grau de entrada + 1) * (grau de saída + 1), e cada um faz uma busca para frente e
+ * outra para trás podadas pelos rótulos dos centros anteriores.
+ */
+void IndiceAlcance::constroi(const ComponentesFortes::Condensacao &condensacao, Indice &indice)
+{
+    const GrafoCSR &dag = condensacao.dag;
+    int numero = condensacao.numero();
+    indice.numero = numero;
+    indice.componentes = condensacao.componentes;
+    indice.ciclicas = condensacao.ciclicas;
+    indice.sucessores.assign(numero, std::vector<int>());
+    indice.antecessores.assign(numero, std::vector<int>());
+    for (int c = 0; c < numero; c++)
+    {
+        for (int a = dag.inicio[c]; a < dag.inicio[c + 1]; a++)
+        {
+            indice.sucessores[c].push_back(dag.destinos[a]);
+            indice.antecessores[dag.destinos[a]].push_back(c);
+        }
+    }
+    numeraPosOrdem(indice);
+    indice.centros.resize(numero);
+    for (int c = 0; c < numero; c++)
+    {
+        indice.centros[c] = c;
+    }
+    std::vector<long long> importancia(numero);
+    for (int c = 0; c < numero; c++)
+    {
+        importancia[c] = (long long)(indice.antecessores[c].size() + 1) * (indice.sucessores[c].size() + 1);
+    }
+    std::stable_sort(indice.centros.begin(), indice.centros.end(), [&](int a, int b)
+                     { return importancia[a] > importancia[b]; });
+    indice.saida.assign(numero, std::vector<int>());
+    indice.entrada.assign(numero, std::vector<int>());
+    std::vector<char> marcas(numero, 0);
+    for (int posto = 0; posto < numero; posto++)
+    {
+        retomaBusca(indice, posto, indice.centros[posto], true, marcas);
+        retomaBusca(indice, posto, indice.centros[posto], false, marcas);
+    }
+}
+
+/**
+ * Incorpora ao índice o arco (u, v) do grafo original (índices densos), inserido depois da construção.
+ * Se v já era alcançável a partir de u nada muda. Caso contrário, as buscas dos centros que alcançam a componente
+ * de u são retomadas a partir da componente de v, e as dos centros alcançados pela componente de v são retomadas
+ * para trás a partir da componente de u. A cobertura por árvore continua válida; o corte negativo também, exceto
+ * quando o arco vai contra a pós-ordem, caso em que é desativado.
+ * Retorna false, sem alterar o índice, quando o arco fecha um ciclo entre componentes distintas: as componentes
+ * se fundem e o índice deve ser reconstruído.
+ */
+bool IndiceAlcance::insereArco(Indice &indice, int u, int v)
+{
+    int a = indice.componentes[u];
+    int b = indice.componentes[v];
+    if (a == b)
+    {
+        indice.ciclicas[a] = 1; // laço, ou arco interno a uma componente que já era cíclica
+        return true;
+    }
+    if (indice.alcancaComponente(a, b))
+    {
+        return true;
+    }
+    if (indice.alcancaComponente(b, a))
+    {
+        return false;
+    }
+    indice.sucessores[a].push_back(b);
+    indice.antecessores[b].push_back(a);
+    if (indice.corteNegativo && indice.posOrdem[b] > indice.posOrdem[a])
+    {
+        indice.corteNegativo = false;
+    }
+    else if (indice.corteNegativo)
+    {
+        int minimo = indice.minimoAlcancado[b];
+        std::vector<int> pilha;
+        pilha.push_back(a);
+        while (!pilha.empty())
+        {
+            int c = pilha.back();
+            pilha.pop_back();
+            if (minimo >= indice.minimoAlcancado[c])
+            {
+                continue;
+            }
+            indice.minimoAlcancado[c] = minimo;
+            for (int antecessor : indice.antecessores[c])
+            {
+                pilha.push_back(antecessor);
+            }
+        }
+    }
+    std::vector<char> marcas(indice.numero, 0);
+    std::vector<int> centrosEntrada = indice.entrada[a];
+    for (int posto : centrosEntrada)
+    {
+        retomaBusca(indice, posto, b, true, marcas);
+    }
+    std::vector<int> centrosSaida = indice.saida[b];
+    for (int posto : centrosSaida)
+    {
+        retomaBusca(indice, posto, a, false, marcas);
+    }
+    return true;
+}
+
+/**
+ * Grava o índice: cabeçalho fixo, componentes dos vértices, pós-ordem, intervalos, mínimos, centros e as listas de
+ * rótulos achatadas em formato CSR (inteiros de 32 bits), seguidos das marcas de componentes cíclicas (um byte
+ * cada). As adjacências do DAG não são gravadas, pois são refeitas a partir do grafo na carga.
+ * Retorna false caso a escrita falhe.
+ */
+bool IndiceAlcance::salva(const Indice &indice, const GrafoCSR &csr, const std::string &caminho)
+{
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo)
+    {
+        return false;
+    }
+    std::vector<int> inicioSaida(1, 0);
+    std::vector<int> rotulosSaida;
+    std::vector<int> inicioEntrada(1, 0);
+    std::vector<int> rotulosEntrada;
+    for (int c = 0; c < indice.numero; c++)
+    {
+        rotulosSaida.insert(rotulosSaida.end(), indice.saida[c].begin(), indice.saida[c].end());
+        inicioSaida.push_back(rotulosSaida.size());
+        rotulosEntrada.insert(rotulosEntrada.end(), indice.entrada[c].begin(), indice.entrada[c].end());
+        inicioEntrada.push_back(rotulosEntrada.size());
+    }
+    Cabecalho cabecalho;
+    memset(&cabecalho, 0, sizeof(Cabecalho));
+    CacheBinario::preencheIndice(cabecalho.indice, ASSINATURA_ALCANCE, VERSAO_ALCANCE, csr);
+    cabecalho.numero = indice.numero;
+    cabecalho.corteNegativo = indice.corteNegativo;
+    cabecalho.rotulosSaida = rotulosSaida.size();
+    cabecalho.rotulosEntrada = rotulosEntrada.size();
+    arquivo.write(reinterpret_cast<const char *>(&cabecalho), sizeof(Cabecalho));
+    CacheBinario::escreveVetor(arquivo, indice.componentes);
+    CacheBinario::escreveVetor(arquivo, indice.posOrdem);
+    CacheBinario::escreveVetor(arquivo, indice.inicioArvore);
+    CacheBinario::escreveVetor(arquivo, indice.minimoAlcancado);
+    CacheBinario::escreveVetor(arquivo, indice.centros);
+    CacheBinario::escreveVetor(arquivo, inicioSaida);
+    CacheBinario::escreveVetor(arquivo, rotulosSaida);
+    CacheBinario::escreveVetor(arquivo, inicioEntrada);
+    CacheBinario::escreveVetor(arquivo, rotulosEntrada);
+    arquivo.write(indice.ciclicas.data(), indice.ciclicas.size());
+    return (bool)arquivo;
+}
+
+/**
+ * Separa uma lista de rótulos achatada em listas por componente. Retorna false se os deslocamentos ou os postos
+ * forem inconsistentes.
+ */
+bool IndiceAlcance::separaRotulos(const std::vector<int> &inicio, const std::vector<int> &rotulos, int numero, std::vector<std::vector<int>> &listas)
+{
+    if (inicio[0] != 0 || inicio[numero] != (int)rotulos.size())
+    {
+        return false;
+    }
+    listas.assign(numero, std::vector<int>());
+    for (int c = 0; c < numero; c++)
+    {
+        if (inicio[c] > inicio[c + 1])
+        {
+            return false;
+        }
+        listas[c].assign(rotulos.begin() + inicio[c], rotulos.begin() + inicio[c + 1]);
+        for (int k = inicio[c]; k < inicio[c + 1]; k++)
+        {
+            if (rotulos[k] < 0 || rotulos[k] >= numero || (k > inicio[c] && rotulos[k - 1] >= rotulos[k]))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Carrega um índice gravado por salva; 'indice' só é alterado se o arquivo for válido para 'csr'.
+ */
+bool IndiceAlcance::carrega(const std::string &caminho, const GrafoCSR &csr, Indice &indice)
+{
+    ArquivoMapeado arquivo(caminho);
+    Cabecalho cabecalho;
+    const char *cursor = CacheBinario::abreIndice(arquivo, ASSINATURA_ALCANCE, VERSAO_ALCANCE, csr, &cabecalho, sizeof(Cabecalho));
+    if (cursor == nullptr || cabecalho.numero < 0 || cabecalho.rotulosSaida < 0 || cabecalho.rotulosEntrada < 0)
+    {
+        return false;
+    }
+    size_t inteiros = (size_t)csr.ordem() + 4 * (size_t)cabecalho.numero + 2 * ((size_t)cabecalho.numero + 1) +
+                      cabecalho.rotulosSaida + cabecalho.rotulosEntrada;
+    if (arquivo.tamanho() != sizeof(Cabecalho) + sizeof(int32_t) * inteiros + cabecalho.numero)
+    {
+        return false;
+    }
+    Indice lido;
+    int numero = cabecalho.numero;
+    lido.numero = numero;
+    lido.corteNegativo = cabecalho.corteNegativo != 0;
+    std::vector<int> inicioSaida;
+    std::vector<int> rotulosSaida;
+    std::vector<int> inicioEntrada;
+    std::vector<int> rotulosEntrada;
+    cursor = CacheBinario::leVetor(cursor, lido.componentes, csr.ordem());
+    cursor = CacheBinario::leVetor(cursor, lido.posOrdem, numero);
+    cursor = CacheBinario::leVetor(cursor, lido.inicioArvore, numero);
+    cursor = CacheBinario::leVetor(cursor, lido.minimoAlcancado, numero);
+    cursor = CacheBinario::leVetor(cursor, lido.centros, numero);
+    cursor = CacheBinario::leVetor(cursor, inicioSaida, numero + 1);
+    cursor = CacheBinario::leVetor(cursor, rotulosSaida, cabecalho.rotulosSaida);
+    cursor = CacheBinario::leVetor(cursor, inicioEntrada, numero + 1);
+    cursor = CacheBinario::leVetor(cursor, rotulosEntrada, cabecalho.rotulosEntrada);
+    lido.ciclicas.assign(cursor, cursor + numero);
+    for (int componente : lido.componentes)
+    {
+        if (componente < 0 || componente >= numero)
+        {
+            return false;
+        }
+    }
+    std::vector<char> usado(numero, 0);
+    for (int c = 0; c < numero; c++)
+    {
+        int centro = lido.centros[c];
+        if (centro < 0 || centro >= numero || usado[centro])
+        {
+            return false;
+        }
+        usado[centro] = 1;
+    }
+    if (!separaRotulos(inicioSaida, rotulosSaida, numero, lido.saida) || !separaRotulos(inicioEntrada, rotulosEntrada, numero, lido.entrada))
+    {
+        return false;
+    }
+    // as adjacências do DAG são refeitas a partir dos arcos do grafo que ligam componentes distintas
+    lido.sucessores.assign(numero, std::vector<int>());
+    lido.antecessores.assign(numero, std::vector<int>());
+    for (int a = 0; a < csr.numeroArcos(); a++)
+    {
+        int origem = lido.componentes[csr.origens[a]];
+        int destino = lido.componentes[csr.destinos[a]];
+        if (origem != destino)
+        {
+            lido.sucessores[origem].push_back(destino);
+        }
+    }
+    for (int c = 0; c < numero; c++)
+    {
+        std::vector<int> &sucessores = lido.sucessores[c];
+        std::sort(sucessores.begin(), sucessores.end());
+        sucessores.erase(std::unique(sucessores.begin(), sucessores.end()), sucessores.end());
+        for (int s : sucessores)
+        {
+            lido.antecessores[s].push_back(c);
+        }
+    }
+    indice = std::move(lido);
+    return true;
+}
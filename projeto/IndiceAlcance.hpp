@@ -0,0 +1,64 @@
+#ifndef INDICE_ALCANCE_HPP
+#define INDICE_ALCANCE_HPP
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include "GrafoCSR.hpp"
+#include "ComponentesFortes.hpp"
+#include "CacheBinario.hpp"
+
+/**
+ * Índice de alcançabilidade sobre o grafo condensado, para consultas "v pertence ao fecho direto de u" sem
+ * caminhamento e sem a memória quadrática da matriz de FechoTransitivo. Cada consulta entre componentes distintas
+ * passa por até três etapas:
+ * - corte negativo por intervalos: numa pós-ordem da busca em profundidade do DAG, toda componente alcançada por c
+ *   tem número entre o menor número alcançado por c e o número de c;
+ * - corte positivo por cobertura de árvore: as descendentes de c na floresta da busca ocupam um intervalo contíguo
+ *   da pós-ordem terminando em c;
+ * - rótulos 2-hop construídos por marcos podados (pruned landmark labeling): cada componente guarda os centros que
+ *   alcança e os centros que a alcançam, e c alcança d se e somente se as duas listas se intersectam.
+ * Inserções de arcos que não fundem componentes são incorporadas retomando as buscas dos centros afetados.
+ */
+namespace IndiceAlcance
+{
+    struct Indice
+    {
+        int numero = 0;                         // componentes do grafo condensado
+        std::vector<int> componentes;           // componente de cada vértice do grafo original
+        std::vector<char> ciclicas;             // componentes que alcançam a si mesmas
+        std::vector<int> posOrdem;              // número de cada componente na pós-ordem da floresta de busca
+        std::vector<int> inicioArvore;          // menor número da pós-ordem na subárvore da componente
+        std::vector<int> minimoAlcancado;       // menor número da pós-ordem entre as componentes alcançadas
+        bool corteNegativo = true;              // falso quando uma inserção viola a pós-ordem
+        std::vector<int> centros;               // componente de cada posto (posto 0 é o centro mais importante)
+        std::vector<std::vector<int>> saida;    // postos dos centros alcançados pela componente, em ordem crescente
+        std::vector<std::vector<int>> entrada;  // postos dos centros que alcançam a componente, em ordem crescente
+        std::vector<std::vector<int>> sucessores;
+        std::vector<std::vector<int>> antecessores;
+
+        bool alcancaComponente(int origem, int destino) const;
+        bool alcanca(int u, int v) const;
+        long long rotulos() const;
+    };
+
+    struct Cabecalho
+    {
+        CacheBinario::CabecalhoIndice indice;
+        int32_t numero;
+        int32_t corteNegativo;
+        int32_t rotulosSaida;
+        int32_t rotulosEntrada;
+    };
+
+    void constroi(const ComponentesFortes::Condensacao &condensacao, Indice &indice);
+    bool insereArco(Indice &indice, int u, int v);
+    bool cobre(const std::vector<int> &saida, const std::vector<int> &entrada, int limite);
+    void retomaBusca(Indice &indice, int posto, int inicio, bool frente, std::vector<char> &marcas);
+    void numeraPosOrdem(Indice &indice);
+    bool salva(const Indice &indice, const GrafoCSR &csr, const std::string &caminho);
+    bool carrega(const std::string &caminho, const GrafoCSR &csr, Indice &indice);
+    bool separaRotulos(const std::vector<int> &inicio, const std::vector<int> &rotulos, int numero, std::vector<std::vector<int>> &listas);
+}
+
+#endif
@@ -28,7 +28,26 @@ int main(int argc, char* argv[])
         int direcionado = std::stoi(argv[4]);
         int arestasPonderadas = std::stoi(argv[5]);
         int verticesPonderados = std::stoi(argv[6]);
-        Opcoes::operacoesBasicas(arquivoInstancia, arquivoSaida, direcionado, arestasPonderadas, verticesPonderados);
+        int threads = argc == 8 ? std::stoi(argv[7]) : 0;
+        Opcoes::operacoesBasicas(arquivoInstancia, arquivoSaida, direcionado, arestasPonderadas, verticesPonderados, threads);
+    } else if (std::stoi(argv[1]) == 3)
+    {
+        if (argc < 4)
+        {
+            std::cout << "Número insuficiente de argumentos\n";
+            return 1;
+        }
+        std::string arquivoInstancia = argv[2];
+        int formato = std::stoi(argv[3]);
+        if ((formato != 1 && formato != 2) || (formato == 2 && argc < 7))
+        {
+            std::cout << "Opção inválida de formato da instância\n";
+            return 1;
+        }
+        int direcionado = formato == 2 ? std::stoi(argv[4]) : 0;
+        int arestasPonderadas = formato == 2 ? std::stoi(argv[5]) : 0;
+        int verticesPonderados = formato == 2 ? std::stoi(argv[6]) : 1;
+        Opcoes::converteParaCache(arquivoInstancia, formato, direcionado, arestasPonderadas, verticesPonderados);
     } else
     {
         std::cout << "Opção inválida de funcionalidade\n";
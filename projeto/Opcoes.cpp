@@ -2,9 +2,13 @@
 
 void Opcoes::MGGPP(std::string &arquivoInstancia, std::string &arquivoSaida, int opcaoAlgoritmo, float alfa = 0)
 {
-    std::ifstream instancia(arquivoInstancia);
-    int particoes = Reader::getNumeroDeParticoes(instancia);
-    Grafo *grafo = Reader::readGrafo(instancia);
+    int particoes;
+    Grafo *grafo = carregaInstanciaMGGPP(arquivoInstancia, particoes);
+    if (grafo == nullptr)
+    {
+        return;
+    }
+    grafo->printMemoria();
     Grafo *solucao = nullptr;
     switch (opcaoAlgoritmo)
     {
@@ -32,21 +36,90 @@ void Opcoes::MGGPP(std::string &arquivoInstancia, std::string &arquivoSaida, int
     delete grafo;
 }
 
-void Opcoes::operacoesBasicas(std::string &arquivoInstancia, std::string &arquivoSaida, int direcionado, int arestasPonderadas, int verticesPonderados)
+void Opcoes::operacoesBasicas(std::string &arquivoInstancia, std::string &arquivoSaida, int direcionado, int arestasPonderadas, int verticesPonderados, int threads)
 {
-    std::ifstream input(arquivoInstancia);
-    Grafo *grafo = new Grafo(input, direcionado, arestasPonderadas, verticesPonderados);
+    Grafo *grafo = carregaListaArestas(arquivoInstancia, direcionado, arestasPonderadas, verticesPonderados, threads);
+    if (grafo == nullptr)
+    {
+        return;
+    }
+    grafo->setThreads(threads);
+    grafo->printMemoria();
     std::ofstream output(arquivoSaida);
     opcoes(grafo, output);
     output.close();
     delete grafo;
 }
 
+/**
+ * Carrega uma instância do MGGPP, utilizando o cache binário "<instancia>.bin" quando ele for válido e
+ * mais recente que o arquivo de instância.
+ */
+Grafo *Opcoes::carregaInstanciaMGGPP(std::string &arquivoInstancia, int &particoes)
+{
+    std::string arquivoCache = CacheBinario::getCaminhoCache(arquivoInstancia);
+    GrafoCSR csr;
+    if (CacheBinario::cacheValido(arquivoCache, arquivoInstancia, 0, 0, 1) && CacheBinario::carregar(arquivoCache, csr, particoes))
+    {
+        return new Grafo(std::move(csr));
+    }
+    return Reader::readGrafo(arquivoInstancia, particoes);
+}
+
+/**
+ * Carrega uma instância no formato de lista de arestas, utilizando o cache binário "<instancia>.bin" quando
+ * ele for válido, mais recente que o arquivo de instância e gerado com as mesmas flags.
+ */
+Grafo *Opcoes::carregaListaArestas(std::string &arquivoInstancia, int direcionado, int arestasPonderadas, int verticesPonderados, int threads)
+{
+    std::string arquivoCache = CacheBinario::getCaminhoCache(arquivoInstancia);
+    GrafoCSR csr;
+    int particoes;
+    if (CacheBinario::cacheValido(arquivoCache, arquivoInstancia, direcionado, arestasPonderadas, verticesPonderados) && CacheBinario::carregar(arquivoCache, csr, particoes))
+    {
+        return new Grafo(std::move(csr));
+    }
+    return Reader::readListaArestas(arquivoInstancia, direcionado, arestasPonderadas, verticesPonderados, threads);
+}
+
+/**
+ * Lê a instância textual e grava seu cache binário em "<instancia>.bin".
+ * - formato 1: instância do MGGPP (.dat);
+ * - formato 2: lista de arestas, com as flags especificadas.
+ */
+void Opcoes::converteParaCache(std::string &arquivoInstancia, int formato, int direcionado, int arestasPonderadas, int verticesPonderados)
+{
+    int particoes = -1;
+    Grafo *grafo = nullptr;
+    if (formato == 1)
+    {
+        grafo = Reader::readGrafo(arquivoInstancia, particoes);
+    }
+    else
+    {
+        grafo = Reader::readListaArestas(arquivoInstancia, direcionado, arestasPonderadas, verticesPonderados);
+    }
+    if (grafo == nullptr)
+    {
+        return;
+    }
+    std::string arquivoCache = CacheBinario::getCaminhoCache(arquivoInstancia);
+    if (CacheBinario::salvar(grafo->congelar(), particoes, arquivoCache))
+    {
+        std::cout << "Cache gravado em " << arquivoCache << '\n';
+    }
+    else
+    {
+        std::cout << "Nao foi possivel gravar o cache em " << arquivoCache << '\n';
+    }
+    delete grafo;
+}
+
 /**
  * Função utilitária para salvar um grafo em um arquivo de saída caso seja essa
  * a vontade do usuário.
  */
-void Opcoes::salvarResultado(Grafo *g, std::ofstream &output, bool profundidade = false)
+void Opcoes::salvarResultado(Grafo *g, std::ofstream &output)
 {
     if (g == nullptr)
     {
@@ -61,18 +134,30 @@ void Opcoes::salvarResultado(Grafo *g, std::ofstream &output, bool profundidade
     }
     if (opcao == 1)
     {
-        if (profundidade)
-        {
-            Printer::printArvoreCaminhamento(g->vertices, output);
-        }
-        else
-        {
-            g->print(output);
-        }
+        g->print(output);
     }
     delete g;
 }
 
+/**
+ * Função utilitária para perguntar ao usuário se deseja salvar a árvore de um caminhamento em profundidade
+ * do grafo g no arquivo de saída.
+ */
+void Opcoes::salvarCaminhamento(Grafo *g, const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &output)
+{
+    int opcao = -1;
+    while (opcao != 1 && opcao != 2)
+    {
+        std::cout << "Deseja salvar o grafo no arquivo de saída? Sim-1 Não-2 ";
+        std::cin >> opcao;
+        std::cout << std::endl;
+    }
+    if (opcao == 1)
+    {
+        g->printCaminhamento(caminhamento, output);
+    }
+}
+
 /**
  * Função utilitária para ler um subconjunto de vértices para utilização nas funcionalidades de AGM.
  */
@@ -92,6 +177,157 @@ std::vector<int> Opcoes::lerSubconjunto()
     return subconjunto;
 }
 
+/**
+ * Função utilitária para preparar, gravar ou carregar as tabelas de marcos utilizadas pelo caminho mínimo por Dijkstra.
+ */
+void Opcoes::marcos(Grafo *g)
+{
+    int opcao;
+    std::cout << "1 - Calcular marcos 2 - Salvar marcos em arquivo 3 - Carregar marcos de arquivo ";
+    std::cin >> opcao;
+    std::cout << std::endl;
+    if (opcao == 1)
+    {
+        int quantidade;
+        std::cout << "Digite a quantidade de marcos: ";
+        std::cin >> quantidade;
+        int preparados = g->preparaMarcos(quantidade);
+        if (preparados == -1)
+        {
+            std::cout << "Marcos exigem grafo ponderado nas arestas e sem arestas negativas\n";
+        }
+        else
+        {
+            std::cout << preparados << " marcos preparados\n";
+        }
+    }
+    else if (opcao == 2 || opcao == 3)
+    {
+        std::string caminho;
+        std::cout << "Digite o caminho do arquivo de marcos: ";
+        std::cin >> caminho;
+        if (opcao == 2)
+        {
+            std::cout << (g->salvaMarcos(caminho) ? "Marcos gravados em " : "Nao foi possivel gravar os marcos em ") << caminho << '\n';
+        }
+        else
+        {
+            std::cout << (g->carregaMarcos(caminho) ? "Marcos carregados de " : "Arquivo de marcos invalido para este grafo: ") << caminho << '\n';
+        }
+    }
+    else
+    {
+        std::cout << "Opção inválida\n";
+    }
+}
+
+/**
+ * Função utilitária para construir, gravar ou carregar a hierarquia de contração utilizada pelo caminho mínimo por Dijkstra.
+ */
+void Opcoes::hierarquia(Grafo *g)
+{
+    int opcao;
+    std::cout << "1 - Construir hierarquia 2 - Salvar hierarquia em arquivo 3 - Carregar hierarquia de arquivo ";
+    std::cin >> opcao;
+    std::cout << std::endl;
+    if (opcao == 1)
+    {
+        if (g->preparaHierarquia())
+        {
+            std::cout << "Hierarquia de contracao construida\n";
+        }
+        else
+        {
+            std::cout << "A hierarquia exige grafo ponderado nas arestas e sem arestas negativas\n";
+        }
+    }
+    else if (opcao == 2 || opcao == 3)
+    {
+        std::string caminho;
+        std::cout << "Digite o caminho do arquivo da hierarquia: ";
+        std::cin >> caminho;
+        if (opcao == 2)
+        {
+            std::cout << (g->salvaHierarquia(caminho) ? "Hierarquia gravada em " : "Nao foi possivel gravar a hierarquia em ") << caminho << '\n';
+        }
+        else
+        {
+            std::cout << (g->carregaHierarquia(caminho) ? "Hierarquia carregada de " : "Arquivo de hierarquia invalido para este grafo: ") << caminho << '\n';
+        }
+    }
+    else
+    {
+        std::cout << "Opção inválida\n";
+    }
+}
+
+/**
+ * Função utilitária para calcular o fecho transitivo de todos os vértices, consultar pares e gravar a matriz de alcance.
+ */
+void Opcoes::fechoCompleto(Grafo *g)
+{
+    int opcao;
+    std::cout << "1 - Calcular fecho 2 - Consultar par de vertices 3 - Salvar matriz em arquivo ";
+    std::cin >> opcao;
+    std::cout << std::endl;
+    if (opcao == 1)
+    {
+        std::cout << "O fecho transitivo possui " << g->fechoTransitivoCompleto() << " pares (u, v) com v alcancavel a partir de u\n";
+    }
+    else if (opcao == 2)
+    {
+        int idU;
+        int idV;
+        std::cout << "Digite os ids dos vertices u e v: ";
+        std::cin >> idU >> idV;
+        std::cout << idV << (g->alcanca(idU, idV) ? " pertence" : " nao pertence") << " ao fecho transitivo direto de " << idU << '\n';
+    }
+    else if (opcao == 3)
+    {
+        std::string caminho;
+        std::cout << "Digite o caminho do arquivo da matriz: ";
+        std::cin >> caminho;
+        std::cout << (g->salvaFechoTransitivo(caminho) ? "Matriz gravada em " : "Nao foi possivel gravar a matriz em ") << caminho << '\n';
+    }
+    else
+    {
+        std::cout << "Opção inválida\n";
+    }
+}
+
+/**
+ * Função utilitária para construir, gravar ou carregar o índice de alcançabilidade utilizado nas consultas de pares.
+ */
+void Opcoes::indiceAlcance(Grafo *g)
+{
+    int opcao;
+    std::cout << "1 - Construir indice 2 - Salvar indice em arquivo 3 - Carregar indice de arquivo ";
+    std::cin >> opcao;
+    std::cout << std::endl;
+    if (opcao == 1)
+    {
+        std::cout << "Indice de alcance construido com " << g->preparaIndiceAlcance() << " rotulos\n";
+    }
+    else if (opcao == 2 || opcao == 3)
+    {
+        std::string caminho;
+        std::cout << "Digite o caminho do arquivo do indice: ";
+        std::cin >> caminho;
+        if (opcao == 2)
+        {
+            std::cout << (g->salvaIndiceAlcance(caminho) ? "Indice gravado em " : "Nao foi possivel gravar o indice em ") << caminho << '\n';
+        }
+        else
+        {
+            std::cout << (g->carregaIndiceAlcance(caminho) ? "Indice carregado de " : "Arquivo de indice invalido para este grafo: ") << caminho << '\n';
+        }
+    }
+    else
+    {
+        std::cout << "Opção inválida\n";
+    }
+}
+
 /**
  * Função utilitária para exibir as opções disponíveis para o usuário.
  */
@@ -110,6 +346,11 @@ void Opcoes::opcoes(Grafo *g, std::ofstream &output)
         std::cout << "7 - Arvore de caminhamento em profundidade\n";
         std::cout << "8 - Analise de excentricidade\n";
         std::cout << "9 - Conjunto dos vértices de articulacao\n";
+        std::cout << "11 - Marcos para caminho minimo (ALT)\n";
+        std::cout << "12 - Hierarquia de contracao para caminho minimo\n";
+        std::cout << "13 - Componentes fortemente conexas (grafo condensado)\n";
+        std::cout << "14 - Fecho transitivo de todos os vertices\n";
+        std::cout << "15 - Indice de alcance entre vertices\n";
         std::cout << "10 - Sair" << std::endl;
         std::cin >> opcao;
         switch (opcao)
@@ -181,8 +422,11 @@ void Opcoes::opcoes(Grafo *g, std::ofstream &output)
             std::cout << "Digite o id do vertice para iniciar o caminhamento em profundidade:\n";
             int idVertice;
             std::cin >> idVertice;
-            Grafo *fecho = g->caminhamentoProfundidade(idVertice);
-            salvarResultado(fecho, output, true);
+            BuscaProfundidade::Caminhamento caminhamento;
+            if (g->caminhamentoProfundidade(idVertice, caminhamento))
+            {
+                salvarCaminhamento(g, caminhamento, output);
+            }
             break;
         }
         case 8:
@@ -200,6 +444,32 @@ void Opcoes::opcoes(Grafo *g, std::ofstream &output)
             std::cout << "Saindo!\n";
             break;
         }
+        case 11:
+        {
+            marcos(g);
+            break;
+        }
+        case 12:
+        {
+            hierarquia(g);
+            break;
+        }
+        case 13:
+        {
+            Grafo *condensado = g->componentesFortementeConexas();
+            salvarResultado(condensado, output);
+            break;
+        }
+        case 14:
+        {
+            fechoCompleto(g);
+            break;
+        }
+        case 15:
+        {
+            indiceAlcance(g);
+            break;
+        }
         default:
         {
             std::cout << "Opção inválida\n";
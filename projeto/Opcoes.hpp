@@ -5,6 +5,7 @@
 #include "Grafo.hpp"
 #include "Reader.hpp"
 #include "Printer.hpp"
+#include "CacheBinario.hpp"
 
 namespace Opcoes
 {
@@ -16,8 +17,17 @@ namespace Opcoes
             std::string &arquivoSaida, 
             int direcionado, 
             int arestasPonderadas, 
-            int verticesPonderados);
-    void salvarResultado(Grafo *g, std::ofstream &output, bool profundidade);
+            int verticesPonderados,
+            int threads);
+    Grafo *carregaInstanciaMGGPP(std::string &arquivoInstancia, int &particoes);
+    Grafo *carregaListaArestas(std::string &arquivoInstancia, int direcionado, int arestasPonderadas, int verticesPonderados, int threads = 0);
+    void converteParaCache(std::string &arquivoInstancia, int formato, int direcionado, int arestasPonderadas, int verticesPonderados);
+    void salvarResultado(Grafo *g, std::ofstream &output);
+    void salvarCaminhamento(Grafo *g, const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &output);
     std::vector<int> lerSubconjunto();
+    void marcos(Grafo *g);
+    void hierarquia(Grafo *g);
+    void fechoCompleto(Grafo *g);
+    void indiceAlcance(Grafo *g);
     void opcoes(Grafo *g, std::ofstream &output);
 } // namespace Options
@@ -1,41 +1,45 @@
 #include "Printer.hpp"
 
 /**
- * Retorna a string que representa uma aresta a ser inserida no arquivo de saída de acordo com as
- * configurações específicadas.
+ * Escreve o grafo no arquivo de saída no formato DOT, de acordo com as configurações especificadas.
  */
 void Printer::printGrafo(std::vector<Vertice *> &vertices, bool direcionado, bool arestasPonderadas, bool verticesPonderados, std::ofstream &arquivo)
 {
-    std::string cabecalho = direcionado ? "digraph G {\n\n" : "graph G {\n\n";
-    arquivo << cabecalho;
+    BufferSaida saida(arquivo);
+    saida.escreve(direcionado ? "digraph G {\n\n" : "graph G {\n\n");
     if (verticesPonderados)
     {
-        printVerticesPonderados(vertices, arquivo);
+        printVerticesPonderados(vertices, saida);
     }
     if (direcionado)
     {
-        printArestasDirecionadas(vertices, arestasPonderadas, arquivo);
+        printArestasDirecionadas(vertices, arestasPonderadas, saida);
     }
     else
     {
-        printArestasNaoDirecionadas(vertices, arestasPonderadas, arquivo);
+        printArestasNaoDirecionadas(vertices, arestasPonderadas, saida);
     }
-    arquivo << "\n}\n\n";
+    saida.escreve("\n}\n\n");
 }
 
 void Printer::printGrafo(std::vector<Vertice *> &vertices, bool direcionado, bool arestasPonderadas, bool verticesPonderados)
 {
-    std::cout << "O grafo possui " << vertices.size() << " vertices\n";
+    BufferSaida saida(std::cout);
+    saida.escreve("O grafo possui ");
+    saida.escreve((int)vertices.size());
+    saida.escreve(" vertices\n");
     for (const Vertice *vertice : vertices)
     {
-        std::cout << vertice->id << " -> { ";
+        saida.escreve(vertice->id);
+        saida.escreve(" -> { ");
         Aresta *aresta = vertice->arestas;
         while (aresta != nullptr)
         {
-            std::cout << aresta->destino->id << " ";
+            saida.escreve(aresta->destino->id);
+            saida.escreve(' ');
             aresta = aresta->prox;
         }
-        std::cout << "}\n";
+        saida.escreve("}\n");
     }
 }
 
@@ -43,89 +47,129 @@ void Printer::printGrafo(std::vector<Vertice *> &vertices, bool direcionado, boo
  * Imprime os vértices para o arquivo definindo o label de cada um como "<id> <(peso)>",
  * no caso de grafos com vértices ponderados.
  */
-void Printer::printVerticesPonderados(std::vector<Vertice *> &vertices, std::ofstream &arquivo)
+void Printer::printVerticesPonderados(std::vector<Vertice *> &vertices, BufferSaida &saida)
 {
     for (const Vertice *vertice : vertices)
     {
-        arquivo << '\t' << vertice->id << " [label=" << '"' << vertice->id << "(p=" << vertice->peso << ")" << '"' << "];\n";
+        saida.escreve('\t');
+        saida.escreve(vertice->id);
+        saida.escreve(" [label=\"");
+        saida.escreve(vertice->id);
+        saida.escreve("(p=");
+        saida.escreve(vertice->peso);
+        saida.escreve(")\"];\n");
     }
-    arquivo << '\n';
+    saida.escreve('\n');
 }
 
-std::string Printer::getRepresentacaoAresta(int id, std::string separador, int idDestino, const Aresta &aresta, bool ponderada)
+/**
+ * Escreve a linha que representa uma aresta no arquivo de saída de acordo com as configurações especificadas.
+ */
+void Printer::printRepresentacaoAresta(BufferSaida &saida, int idOrigem, const char *separador, int idDestino, const Aresta &aresta, bool ponderada)
 {
-    std::stringstream formatoAresta;
-    formatoAresta << id << separador << idDestino;
+    saida.escreve('\t');
+    saida.escreve(idOrigem);
+    saida.escreve(separador);
+    saida.escreve(idDestino);
     if (ponderada)
     {
-        formatoAresta << " [label=" << aresta.peso << "]";
+        saida.escreve(" [label=");
+        saida.escreve(aresta.peso);
+        saida.escreve(']');
     }
-    formatoAresta << ";\n";
-    return formatoAresta.str();
+    saida.escreve(";\n");
 }
 
-void Printer::printArestasDirecionadas(std::vector<Vertice *> &vertices, bool arestasPonderadas, std::ofstream &arquivo)
+void Printer::printArestasDirecionadas(std::vector<Vertice *> &vertices, bool arestasPonderadas, BufferSaida &saida)
 {
-    std::string separador = " -> ";
     for (const Vertice *vertice : vertices)
     {
         Aresta *aresta = vertice->arestas;
         while (aresta != nullptr)
         {
-            arquivo << '\t' << getRepresentacaoAresta(vertice->id, separador, aresta->destino->id, *aresta, arestasPonderadas);
+            printRepresentacaoAresta(saida, vertice->id, " -> ", aresta->destino->id, *aresta, arestasPonderadas);
             aresta = aresta->prox;
         }
     }
 }
 
-void Printer::printArestasNaoDirecionadas(std::vector<Vertice *> &vertices, bool arestasPonderadas, std::ofstream &arquivo)
+/**
+ * Cada aresta não-direcionada aparece nas listas de suas duas extremidades; ela é impressa apenas a partir
+ * da extremidade de menor posição no vetor de vértices, o que dispensa qualquer busca por arestas já impressas.
+ */
+void Printer::printArestasNaoDirecionadas(std::vector<Vertice *> &vertices, bool arestasPonderadas, BufferSaida &saida)
 {
-    std::string separador = " -- ";
-    std::set<int> impressos;
     for (const Vertice *vertice : vertices)
     {
         Aresta *aresta = vertice->arestas;
         while (aresta != nullptr)
         {
-            if (std::count(impressos.begin(), impressos.end(), aresta->destino->id)) 
+            if (aresta->destino->indice >= vertice->indice)
             {
-                aresta = aresta->prox;
-                continue; // evita impressão duplicada de uma aresta que tem como uma das extremidades o vértice com tal id
+                printRepresentacaoAresta(saida, vertice->id, " -- ", aresta->destino->id, *aresta, arestasPonderadas);
             }
-            arquivo << '\t' << getRepresentacaoAresta(vertice->id, separador, aresta->destino->id, *aresta, arestasPonderadas);
             aresta = aresta->prox;
         }
-        impressos.insert(vertice->id);
     }
 }
 
 /**
- * Imprime apenas as arestas comuns percorridas no caminhamento em profundidade no terminal.
+ * Agrupa os arcos de árvore e de retorno do caminhamento por vértice de origem, na ordem de descoberta das origens e,
+ * dentro de cada origem, na ordem em que os arcos foram percorridos (a mesma das posições no CSR).
+ * O segundo elemento de cada par indica se o arco é de retorno.
  */
-void Printer:: printArvoreCaminhamento(std::vector<Vertice*>& vertices) 
+void Printer::agrupaArcosCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento, std::vector<std::pair<long long, bool>> &arcos)
 {
-    std::cout << "Árvore de caminhamento em profundidade:\n";
-    for (Vertice *vertice : vertices) 
+    std::vector<int> posicao(csr.ordem(), -1);
+    for (int p = 0; p < caminhamento.ordem.size(); p++)
     {
-        std::cout << vertice->id << " -> { ";
-        Aresta *aresta = vertice->arestas;
-        while (aresta != nullptr) 
+        posicao[caminhamento.ordem[p]] = p;
+    }
+    arcos.clear();
+    for (int k : caminhamento.arcosArvore)
+    {
+        arcos.push_back({((long long)posicao[csr.origens[k]] << 32) | k, false});
+    }
+    for (int k : caminhamento.arcosRetorno)
+    {
+        arcos.push_back({((long long)posicao[csr.origens[k]] << 32) | k, true});
+    }
+    std::sort(arcos.begin(), arcos.end());
+}
+
+/**
+ * Imprime no terminal, para cada vértice na ordem de descoberta, seus filhos na árvore de caminhamento em profundidade.
+ */
+void Printer::printArvoreCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento)
+{
+    std::vector<std::pair<long long, bool>> arcos;
+    agrupaArcosCaminhamento(csr, caminhamento, arcos);
+    BufferSaida saida(std::cout);
+    saida.escreve("Árvore de caminhamento em profundidade:\n");
+    int proximo = 0;
+    for (int p = 0; p < caminhamento.ordem.size(); p++)
+    {
+        saida.escreve(csr.ids[caminhamento.ordem[p]]);
+        saida.escreve(" -> { ");
+        for (; proximo < arcos.size() && (arcos[proximo].first >> 32) == p; proximo++)
         {
-            if (aresta->peso != -1) 
+            if (!arcos[proximo].second)
             {
-                std::cout << aresta->destino->id << " ";
+                saida.escreve(csr.ids[csr.destinos[arcos[proximo].first & 0xffffffff]]);
+                saida.escreve(' ');
             }
-            aresta = aresta->prox;
         }
-        std::cout << "}\n";
+        saida.escreve("}\n");
     }
 }
 
-std::string Printer::getRepresentacaoArestaRetorno(int idOrigem, std::string separador, int idDestino, const Aresta &aresta)
+void Printer::printRepresentacaoArestaRetorno(BufferSaida &saida, int idOrigem, const char *separador, int idDestino)
 {
-    std::stringstream formatoAresta;
-    formatoAresta << idOrigem << separador << idDestino << " [style=dashed];\n";
-    return formatoAresta.str();
+    saida.escreve('\t');
+    saida.escreve(idOrigem);
+    saida.escreve(separador);
+    saida.escreve(idDestino);
+    saida.escreve(" [style=dashed];\n");
 }
 
 /**
@@ -133,22 +177,29 @@ std::string Printer::getRepresentacaoArestaRetorno(int idOrigem, std::string sep
  * tendo como origem o nó raiz.
  * no arquivo de saída.
  */
-void Printer:: printArvoreCaminhamento(std::vector<Vertice*>& vertices, std::ofstream &arquivo)
+void Printer::printArvoreCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &arquivo)
 {
-    arquivo << "digraph G {\n\n";
-    for (Vertice* vertice : vertices)
+    std::vector<std::pair<long long, bool>> arcos;
+    agrupaArcosCaminhamento(csr, caminhamento, arcos);
+    BufferSaida saida(arquivo);
+    saida.escreve("digraph G {\n\n");
+    for (const std::pair<long long, bool> &arco : arcos)
     {
-        Aresta* aresta = vertice->arestas;
-        while (aresta != nullptr) {
-            if (aresta->peso == -1)
-            {
-                arquivo << '\t' << getRepresentacaoArestaRetorno(vertice->id, " -> ", aresta->destino->id, *aresta);
-            } else
-            {
-                arquivo << '\t' << getRepresentacaoAresta(vertice->id, " -> ", aresta->destino->id, *aresta, false);
-            }
-            aresta = aresta->prox;
+        int k = arco.first & 0xffffffff;
+        int idOrigem = csr.ids[csr.origens[k]];
+        int idDestino = csr.ids[csr.destinos[k]];
+        if (arco.second)
+        {
+            printRepresentacaoArestaRetorno(saida, idOrigem, " -> ", idDestino);
+        }
+        else
+        {
+            saida.escreve('\t');
+            saida.escreve(idOrigem);
+            saida.escreve(" -> ");
+            saida.escreve(idDestino);
+            saida.escreve(";\n");
         }
     }
-    arquivo << "\n}\n\n";
-}
\ No newline at end of file
+    saida.escreve("\n}\n\n");
+}
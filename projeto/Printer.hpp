@@ -7,19 +7,22 @@
 #include <string>
 #include <algorithm>
 #include "Grafo.hpp"
-#include <sstream>
+#include "BufferSaida.hpp"
+#include "GrafoCSR.hpp"
+#include "BuscaProfundidade.hpp"
 
 namespace Printer
 {
     void printGrafo(std::vector<Vertice*>& vertices, bool direcionado, bool arestasPonderadas, bool verticesPonderados, std::ofstream &arquivo);
     void printGrafo(std::vector<Vertice*>& vertices, bool direcionado, bool arestasPonderadas, bool verticesPonderados);
-    void printVerticesPonderados(std::vector<Vertice*>& vertices, std::ofstream &arquivo);
-    std::string getRepresentacaoAresta(int idOrigem, std::string separador, int idDestino, const Aresta &aresta, bool ponderada);
-    void printArestasDirecionadas(std::vector<Vertice*>& vertices, bool ponderadoNasArestas, std::ofstream &arquivo);
-    void printArestasNaoDirecionadas(std::vector<Vertice*>& vertices, bool ponderadoNasArestas, std::ofstream &arquivo);
-    void printArvoreCaminhamento(std::vector<Vertice*>& vertices);
-    std::string getRepresentacaoArestaRetorno(int idOrigem, std::string separador, int idDestino, const Aresta &aresta);
-    void printArvoreCaminhamento(std::vector<Vertice*>& vertices, std::ofstream &arquivo);
+    void printVerticesPonderados(std::vector<Vertice*>& vertices, BufferSaida &saida);
+    void printRepresentacaoAresta(BufferSaida &saida, int idOrigem, const char *separador, int idDestino, const Aresta &aresta, bool ponderada);
+    void printArestasDirecionadas(std::vector<Vertice*>& vertices, bool ponderadoNasArestas, BufferSaida &saida);
+    void printArestasNaoDirecionadas(std::vector<Vertice*>& vertices, bool ponderadoNasArestas, BufferSaida &saida);
+    void agrupaArcosCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento, std::vector<std::pair<long long, bool>> &arcos);
+    void printArvoreCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento);
+    void printRepresentacaoArestaRetorno(BufferSaida &saida, int idOrigem, const char *separador, int idDestino);
+    void printArvoreCaminhamento(const GrafoCSR &csr, const BuscaProfundidade::Caminhamento &caminhamento, std::ofstream &arquivo);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,135 +1,253 @@
 #include "Reader.hpp"
-#include <iostream>
-#include <fstream>
-#include <string>
-#include <sstream>
-#include <vector>
-#include <algorithm>
+#include "ArquivoMapeado.hpp"
+#include <charconv>
+#include <thread>
 
-Grafo *Reader::readGrafo(std::ifstream &arquivoInstancia)
+/**
+ * Lê uma instância do MGGPP no formato .dat (AMPL) numa única passada sobre o arquivo mapeado em memória,
+ * reconhecendo as seções "set V", "param w", "set E" e "param p" em qualquer ordem.
+ * - particoes recebe o número de partições definido em "param p" ou -1 caso ele não exista no arquivo;
+ * - caso o arquivo não possa ser aberto, retorna um nullptr.
+ */
+Grafo *Reader::readGrafo(const std::string &caminhoInstancia, int &particoes)
 {
+    ArquivoMapeado arquivo(caminhoInstancia);
+    if (!arquivo.aberto())
+    {
+        std::cout << "Nao foi possivel abrir o arquivo " << caminhoInstancia << '\n';
+        return nullptr;
+    }
     Grafo *grafo = new Grafo(0, 0, 1);
-    std::string cabecalhoVertices = "set V";
-    std::string cabecalhoPesos = "param w";
-    std::string cabecalhoArestas = "set E";
-    std::string linha;
-    while (getline(arquivoInstancia, linha))
+    particoes = -1; // não encontrou o número de partições no arquivo
+    const char *cursor = arquivo.inicio();
+    const char *fim = arquivo.fim();
+    while (cursor < fim)
     {
-        if (linha.find(cabecalhoVertices) != std::string::npos)
+        while (cursor < fim && (*cursor == ' ' || *cursor == '\t' || *cursor == '\r'))
+        {
+            cursor++;
+        }
+        if (comecaCom(cursor, fim, "set V"))
+        {
+            readVertices(cursor, fim, grafo);
+        }
+        else if (comecaCom(cursor, fim, "param w"))
+        {
+            readPesos(cursor, fim, grafo);
+        }
+        else if (comecaCom(cursor, fim, "set E"))
+        {
+            readArestas(cursor, fim, grafo);
+        }
+        else if (comecaCom(cursor, fim, "param p"))
         {
-            readVertices(arquivoInstancia, grafo);
+            particoes = readParticoes(cursor, fim);
         }
-        else if (linha.find(cabecalhoPesos) != std::string::npos)
+        while (cursor < fim && *cursor != '\n') // descarta o restante da linha
         {
-            readPesos(arquivoInstancia, grafo);
+            cursor++;
         }
-        else if (linha.find(cabecalhoArestas) != std::string::npos)
+        if (cursor < fim)
         {
-            readArestas(arquivoInstancia, grafo);
+            cursor++;
         }
     }
     return grafo;
 }
 
-void Reader::readVertices(std::ifstream &arquivoInstancia, Grafo *grafo)
+/**
+ * Retorna true se o texto a partir do cursor começa com o prefixo especificado.
+ */
+bool Reader::comecaCom(const char *cursor, const char *fim, const char *prefixo)
 {
-    std::string linha;
-    while (getline(arquivoInstancia, linha))
+    for (; *prefixo != '\0'; prefixo++, cursor++)
     {
-        if (linha.find(";") != std::string::npos)
+        if (cursor == fim || *cursor != *prefixo)
         {
-            break;
-        }
-        std::stringstream stream(linha);
-        std::string item;
-        while (getline(stream, item, ' '))
-        {
-            if (item.size() > 0)
-            {
-                int id = std::stoi(item);
-                grafo->adicionaVertice(id);
-            }
+            return false;
         }
     }
+    return true;
 }
 
-void Reader::readPesos(std::ifstream &arquivoInstancia, Grafo *grafo)
+/**
+ * Lê o próximo inteiro da seção atual, ignorando espaços, quebras de linha e a pontuação do formato
+ * (":=", parênteses e vírgulas).
+ * Retorna false ao encontrar o ';' que encerra a seção (consumindo-o) ou o fim do arquivo.
+ */
+bool Reader::proximoInteiro(const char *&cursor, const char *fim, int &valor)
 {
-    std::string linha;
-    while (getline(arquivoInstancia, linha))
+    while (cursor < fim)
     {
-        if (linha.find(";") != std::string::npos)
+        char c = *cursor;
+        if (c == ';')
         {
-            break;
+            cursor++;
+            return false;
         }
-        std::stringstream stream(linha);
-        std::string item;
-        std::vector<int> infoLinha;
-        while (getline(stream, item, ' '))
+        if ((c >= '0' && c <= '9') || c == '-')
         {
-            if (item.size() > 0)
+            std::from_chars_result resultado = std::from_chars(cursor, fim, valor);
+            if (resultado.ec == std::errc())
             {
-                infoLinha.push_back(std::stoi(item));
+                cursor = resultado.ptr;
+                return true;
             }
         }
-        grafo->getVertice(infoLinha[0])->peso = infoLinha[1];
+        cursor++;
     }
+    return false;
 }
 
-void Reader::readArestas(std::ifstream &arquivoInstancia, Grafo *grafo)
+void Reader::readVertices(const char *&cursor, const char *fim, Grafo *grafo)
 {
-    std::string linha;
-    while (getline(arquivoInstancia, linha))
+    cursor += 5; // "set V"
+    int id;
+    while (proximoInteiro(cursor, fim, id))
     {
-        if (linha.find(";") != std::string::npos)
+        grafo->adicionaVertice(id);
+    }
+}
+
+void Reader::readPesos(const char *&cursor, const char *fim, Grafo *grafo)
+{
+    cursor += 7; // "param w"
+    int id;
+    int peso;
+    while (proximoInteiro(cursor, fim, id) && proximoInteiro(cursor, fim, peso))
+    {
+        Vertice *vertice = grafo->getVertice(id);
+        if (vertice == nullptr)
         {
-            break;
+            grafo->adicionaVertice(id, peso);
         }
-        if (linha.length() == 0)
+        else
         {
-            continue;
+            vertice->peso = peso;
         }
-        std::stringstream stream(linha);
-        std::string aresta;
-        while (getline(stream, aresta, ' '))
+    }
+}
+
+void Reader::readArestas(const char *&cursor, const char *fim, Grafo *grafo)
+{
+    cursor += 5; // "set E"
+    std::vector<ArestaLote> lote;
+    int idOrigem;
+    int idDestino;
+    while (proximoInteiro(cursor, fim, idOrigem) && proximoInteiro(cursor, fim, idDestino))
+    {
+        lote.push_back({idOrigem, idDestino, 0});
+    }
+    grafo->adicionaArestas(lote);
+}
+
+int Reader::readParticoes(const char *&cursor, const char *fim)
+{
+    cursor += 7; // "param p"
+    int particoes = -1;
+    int valor;
+    while (proximoInteiro(cursor, fim, valor))
+    {
+        particoes = valor;
+    }
+    return particoes;
+}
+
+/**
+ * Lê uma instância no formato de lista de arestas (uma linha de cabeçalho seguida de linhas "u v peso").
+ * O arquivo é mapeado em memória e dividido em blocos terminados em quebras de linha, que são lidos em paralelo
+ * para buffers de arestas independentes; os buffers são concatenados na ordem do arquivo e entregues ao
+ * construtor em lote, de modo que o grafo resultante é o mesmo da leitura sequencial.
+ * - threads: número de threads de leitura (0 utiliza o número de núcleos da máquina);
+ * - caso o arquivo não possa ser aberto, retorna um nullptr.
+ */
+Grafo *Reader::readListaArestas(const std::string &caminhoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados, int threads)
+{
+    ArquivoMapeado arquivo(caminhoInstancia);
+    if (!arquivo.aberto())
+    {
+        std::cout << "Nao foi possivel abrir o arquivo " << caminhoInstancia << '\n';
+        return nullptr;
+    }
+    const char *cursor = arquivo.inicio();
+    const char *fim = arquivo.fim();
+    while (cursor < fim && *cursor != '\n') // a primeira linha é o cabeçalho
+    {
+        cursor++;
+    }
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const long TAMANHO_MINIMO_BLOCO = 1 << 20; // blocos menores não compensam o custo de criar uma thread
+    long bytes = fim - cursor;
+    threads = std::max(1L, std::min((long)threads, bytes / TAMANHO_MINIMO_BLOCO));
+    std::vector<const char *> limites = {cursor};
+    for (int i = 1; i < threads; i++)
+    {
+        const char *limite = std::max(limites.back(), cursor + bytes * i / threads);
+        while (limite < fim && *limite != '\n')
         {
-            if (aresta.size() > 0 && aresta.find(",") != std::string::npos)
-            {
-                aresta.erase(0, 1);
-                aresta.erase(aresta.size() - 1, 1);
-                std::stringstream streamAresta(aresta);
-                std::string itemAresta;
-                std::vector<int> infoAresta;
-                while (getline(streamAresta, itemAresta, ','))
-                {
-                    infoAresta.push_back(std::stoi(itemAresta));
-                }
-                grafo->adicionaAresta(infoAresta[0], infoAresta[1]);
-            }
+            limite++;
         }
+        limites.push_back(limite);
+    }
+    limites.push_back(fim);
+    std::vector<std::vector<ArestaLote>> lotes(threads);
+    std::vector<std::thread> leitores;
+    for (int i = 1; i < threads; i++)
+    {
+        leitores.emplace_back(readBlocoListaArestas, limites[i], limites[i + 1], std::ref(lotes[i]));
     }
+    readBlocoListaArestas(limites[0], limites[1], lotes[0]);
+    for (std::thread &leitor : leitores)
+    {
+        leitor.join();
+    }
+    for (int i = 1; i < threads; i++)
+    {
+        lotes[0].insert(lotes[0].end(), lotes[i].begin(), lotes[i].end());
+        std::vector<ArestaLote>().swap(lotes[i]);
+    }
+    Grafo *grafo = new Grafo(direcionado, arestasPonderadas, verticesPonderados);
+    grafo->adicionaArestas(lotes[0]);
+    return grafo;
 }
 
-int Reader::getNumeroDeParticoes(std::ifstream &arquivoInstancia)
+/**
+ * Lê as linhas "u v peso" do intervalo [inicio, fim) para o lote. Linhas com menos de dois inteiros são
+ * ignoradas e a ausência do peso equivale a peso 0.
+ */
+void Reader::readBlocoListaArestas(const char *inicio, const char *fim, std::vector<ArestaLote> &lote)
 {
-    std::string linha;
-    while (getline(arquivoInstancia, linha))
+    lote.reserve((fim - inicio) / 8);
+    const char *cursor = inicio;
+    while (cursor < fim)
     {
-        if (linha.find("param p :=") != std::string::npos)
+        int itens[3] = {0, 0, 0};
+        int lidos = 0;
+        while (cursor < fim && *cursor != '\n')
         {
-            std::stringstream stream(linha);
-            std::string item;
-            std::vector<std::string> infoLinha;
-            while (getline(stream, item, ' '))
+            char c = *cursor;
+            if (lidos < 3 && ((c >= '0' && c <= '9') || c == '-'))
             {
-                if (item.size() > 0)
+                std::from_chars_result resultado = std::from_chars(cursor, fim, itens[lidos]);
+                if (resultado.ec == std::errc())
                 {
-                    infoLinha.push_back(item);
+                    cursor = resultado.ptr;
+                    lidos++;
+                    continue;
                 }
             }
-            int particoes = std::stoi(infoLinha[infoLinha.size() - 2]);
-            return particoes;
+            cursor++;
+        }
+        if (cursor < fim)
+        {
+            cursor++;
+        }
+        if (lidos >= 2)
+        {
+            lote.push_back({itens[0], itens[1], itens[2]});
         }
     }
-    return -1; // não encontrou o número de partições no arquivo
 }
@@ -5,11 +5,15 @@
 
 namespace Reader
 {
-    Grafo *readGrafo(std::ifstream &arquivoInstancia);
-    void readVertices(std::ifstream &arquivoInstancia, Grafo* grafo);
-    void readPesos(std::ifstream &arquivoInstancia, Grafo* grafo);
-    void readArestas(std::ifstream &arquivoInstancia, Grafo* grafo);
-    int getNumeroDeParticoes(std::ifstream &arquivoInstancia);
+    Grafo *readGrafo(const std::string &caminhoInstancia, int &particoes);
+    bool comecaCom(const char *cursor, const char *fim, const char *prefixo);
+    bool proximoInteiro(const char *&cursor, const char *fim, int &valor);
+    void readVertices(const char *&cursor, const char *fim, Grafo *grafo);
+    void readPesos(const char *&cursor, const char *fim, Grafo *grafo);
+    void readArestas(const char *&cursor, const char *fim, Grafo *grafo);
+    int readParticoes(const char *&cursor, const char *fim);
+    Grafo *readListaArestas(const std::string &caminhoInstancia, bool direcionado, bool arestasPonderadas, bool verticesPonderados, int threads = 0);
+    void readBlocoListaArestas(const char *inicio, const char *fim, std::vector<ArestaLote> &lote);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,159 @@
+#include "TodosPares.hpp"
+#include "CaminhoMinimo.hpp"
+#include "Floyd.hpp"
+#include "BuscaLargura.hpp"
+#include "Trabalhadores.hpp"
+#include <cmath>
+#include <atomic>
+#include <thread>
+
+/**
+ * Em grafos sem ponderação nas arestas as distâncias são contadas em arestas e calculadas por buscas em largura.
+ * Nos demais, compara as estimativas de custo das duas abordagens: V execuções de Dijkstra custam cerca de V * (V + E) * log V,
+ * enquanto o Floyd custa V³ dividido pelo número de colunas relaxadas por instrução no laço vetorizado.
+ */
+TodosPares::Estrategia TodosPares::escolheEstrategia(const GrafoCSR &csr)
+{
+    if (!csr.arestasPonderadas)
+    {
+        return BUSCA_LARGURA; // V buscas em largura custam V * (V + E), sempre menos que o Floyd
+    }
+    const double COLUNAS_POR_INSTRUCAO = 8;
+    double ordem = csr.ordem();
+    double custoDijkstra = ordem * (ordem + csr.numeroArcos()) * std::log2(ordem + 2);
+    double custoFloyd = ordem * ordem * ordem / COLUNAS_POR_INSTRUCAO;
+    if (custoFloyd <= custoDijkstra)
+    {
+        return FLOYD;
+    }
+    return CaminhoMinimo::possuiPesosNegativos(csr) ? JOHNSON : DIJKSTRA;
+}
+
+/**
+ * Entrega ao consumidor as distâncias a partir de cada vértice do grafo, utilizando até 'threads' threads
+ * (0 utiliza o número de núcleos da máquina).
+ * Obs.: se o grafo possuir ciclos negativos, recorre ao Floyd, cujo resultado nesse caso é indefinido.
+ */
+void TodosPares::percorreLinhas(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor)
+{
+    if (threads <= 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    switch (escolheEstrategia(csr))
+    {
+    case FLOYD:
+        percorreLinhasFloyd(csr, threads, consumidor);
+        break;
+    case DIJKSTRA:
+        percorreLinhasDijkstra(csr, nullptr, threads, consumidor);
+        break;
+    case BUSCA_LARGURA:
+        percorreLinhasBuscaLargura(csr, threads, consumidor);
+        break;
+    case JOHNSON:
+    {
+        std::vector<int> potenciais;
+        if (CaminhoMinimo::potenciaisJohnson(csr, potenciais))
+        {
+            percorreLinhasDijkstra(csr, &potenciais, threads, consumidor);
+        }
+        else
+        {
+            percorreLinhasFloyd(csr, threads, consumidor);
+        }
+        break;
+    }
+    }
+}
+
+void TodosPares::percorreLinhasFloyd(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor)
+{
+    Floyd::MatrizQuadrada distancias;
+    Floyd::inicializaDistancias(csr, distancias);
+    Floyd::executa(distancias, nullptr, threads);
+    for (int i = 0; i < csr.ordem(); i++)
+    {
+        consumidor(i, distancias.linha(i));
+    }
+}
+
+/**
+ * Executa um Dijkstra completo a partir de cada vértice. As origens são distribuídas dinamicamente entre as threads,
+ * e cada thread reaproveita seu espaço de trabalho do Dijkstra e um único vetor de linha para todas as suas origens.
+ * Se 'potenciais' for diferente de nullptr, as buscas são feitas sobre os pesos reponderados de Johnson e as
+ * distâncias são corrigidas de volta antes de serem entregues.
+ * Se 'origens' for diferente de nullptr, apenas os vértices listados nele são utilizados como origem.
+ */
+void TodosPares::percorreLinhasDijkstra(const GrafoCSR &csr, const std::vector<int> *potenciais, int threads, const ConsumidorLinha &consumidor,
+                                        const std::vector<int> *origens)
+{
+    int ordem = csr.ordem();
+    GrafoCSR reponderado;
+    if (potenciais != nullptr)
+    {
+        reponderado.ids = csr.ids;
+        reponderado.inicio = csr.inicio;
+        reponderado.destinos = csr.destinos;
+        reponderado.pesos = csr.pesos;
+        for (int u = 0; u < ordem; u++)
+        {
+            for (int k = csr.inicio[u]; k < csr.inicio[u + 1]; k++)
+            {
+                reponderado.pesos[k] += (*potenciais)[u] - (*potenciais)[csr.destinos[k]];
+            }
+        }
+    }
+    const GrafoCSR &busca = potenciais != nullptr ? reponderado : csr;
+    int totalOrigens = origens != nullptr ? origens->size() : ordem;
+    std::atomic<int> proximaOrigem(0);
+    auto processaOrigens = [&]()
+    {
+        CaminhoMinimo::EspacoDijkstra &espaco = CaminhoMinimo::getEspacoThread();
+        std::vector<int> linha(ordem);
+        for (int posicao = proximaOrigem++; posicao < totalOrigens; posicao = proximaOrigem++)
+        {
+            int origem = origens != nullptr ? (*origens)[posicao] : posicao;
+            CaminhoMinimo::dijkstra(busca, origem, espaco);
+            for (int v = 0; v < ordem; v++)
+            {
+                int distancia = espaco.distancia(v);
+                if (potenciais != nullptr && distancia != CaminhoMinimo::INFINITO)
+                {
+                    distancia += (*potenciais)[v] - (*potenciais)[origem];
+                }
+                linha[v] = distancia;
+            }
+            consumidor(origem, linha.data());
+        }
+    };
+    Trabalhadores::executa(std::max(1, std::min(threads, totalOrigens)), processaOrigens);
+}
+
+/**
+ * Executa uma busca em largura a partir de cada vértice (ou de cada vértice de 'origens', se diferente de nullptr),
+ * entregando as distâncias em número de arestas. Em grafos direcionados a fotografia invertida é montada uma
+ * única vez e compartilhada pelas threads, para que as buscas possam utilizar o passo ascendente.
+ */
+void TodosPares::percorreLinhasBuscaLargura(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor, const std::vector<int> *origens)
+{
+    int ordem = csr.ordem();
+    GrafoCSR reverso;
+    if (csr.direcionado)
+    {
+        reverso = csr.transposta();
+    }
+    int totalOrigens = origens != nullptr ? origens->size() : ordem;
+    std::atomic<int> proximaOrigem(0);
+    auto processaOrigens = [&]()
+    {
+        BuscaLargura::EspacoBusca &espaco = BuscaLargura::getEspacoThread();
+        for (int posicao = proximaOrigem++; posicao < totalOrigens; posicao = proximaOrigem++)
+        {
+            int origem = origens != nullptr ? (*origens)[posicao] : posicao;
+            BuscaLargura::busca(csr, &reverso, origem, -1, espaco);
+            consumidor(origem, espaco.distancias.data());
+        }
+    };
+    Trabalhadores::executa(std::max(1, std::min(threads, totalOrigens)), processaOrigens);
+}
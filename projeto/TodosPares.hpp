@@ -0,0 +1,41 @@
+#ifndef TODOS_PARES_HPP
+#define TODOS_PARES_HPP
+
+#include <vector>
+#include <functional>
+#include "GrafoCSR.hpp"
+
+/**
+ * Caminhos mínimos entre todos os pares de vértices. A estratégia é escolhida pela densidade do grafo e pelo
+ * sinal dos pesos: Floyd em blocos para grafos densos, Dijkstra a partir de cada vértice para grafos esparsos
+ * e Johnson (Dijkstra sobre os pesos reponderados) para grafos esparsos com arcos negativos. Em grafos sem ponderação
+ * nas arestas, as distâncias são os números de arestas dos caminhos, obtidos por buscas em largura.
+ * As distâncias são entregues linha a linha a um consumidor; nas estratégias baseadas em Dijkstra a matriz
+ * completa nunca é montada.
+ */
+namespace TodosPares
+{
+    enum Estrategia
+    {
+        FLOYD,
+        DIJKSTRA,
+        JOHNSON,
+        BUSCA_LARGURA
+    };
+
+    /**
+     * Recebe o índice denso da origem e suas distâncias para todos os vértices (INFINITO quando não há caminho).
+     * A linha só é válida durante a chamada. O consumidor pode ser chamado simultaneamente por várias threads,
+     * sempre com origens distintas.
+     */
+    typedef std::function<void(int origem, const int *distancias)> ConsumidorLinha;
+
+    Estrategia escolheEstrategia(const GrafoCSR &csr);
+    void percorreLinhas(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor);
+    void percorreLinhasFloyd(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor);
+    void percorreLinhasDijkstra(const GrafoCSR &csr, const std::vector<int> *potenciais, int threads, const ConsumidorLinha &consumidor,
+                                const std::vector<int> *origens = nullptr);
+    void percorreLinhasBuscaLargura(const GrafoCSR &csr, int threads, const ConsumidorLinha &consumidor, const std::vector<int> *origens = nullptr);
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef TRABALHADORES_HPP
+#define TRABALHADORES_HPP
+
+#include <vector>
+#include <thread>
+#include <functional>
+
+/**
+ * Conjunto de threads que executam a mesma função de trabalho, usado pelos algoritmos que repartem origens ou
+ * lotes por um contador atômico compartilhado.
+ */
+namespace Trabalhadores
+{
+    /**
+     * Executa 'trabalhador' em 'threads' threads (uma delas a própria thread chamadora) e aguarda o término de todas.
+     */
+    inline void executa(int threads, const std::function<void()> &trabalhador)
+    {
+        std::vector<std::thread> trabalhadores;
+        for (int i = 1; i < threads; i++)
+        {
+            trabalhadores.emplace_back(trabalhador);
+        }
+        trabalhador();
+        for (std::thread &thread : trabalhadores)
+        {
+            thread.join();
+        }
+    }
+}
+
+#endif
@@ -9,7 +9,10 @@ struct Vertice
 {
     int id;
     int peso;
+    int indice; // posição do vértice no vetor de vértices do grafo
     Aresta* arestas;
+    Aresta* entradas; // arcos que chegam ao vértice, mantidos apenas com o índice de entradas ativo
+    int grauEntrada;  // tamanho da lista de entradas
 };
 
 #endif